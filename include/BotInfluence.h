@@ -0,0 +1,93 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotInfluence.h
+Purpose:		Header file for BotInfluence.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_INFLUENCE_H
+#define BOT_INFLUENCE_H
+
+#define BOT_INFLUENCE_TILE			8					// Cells along each side of a tile
+#define BOT_INFLUENCE_TILE_CELL_NUM	(BOT_INFLUENCE_TILE * BOT_INFLUENCE_TILE)
+#define BOT_INFLUENCE_TILE_NUM_MAX	64					// Maximum number of tiles of a map
+#define BOT_INFLUENCE_CELL_NUM_MAX	(BOT_INFLUENCE_TILE_NUM_MAX * BOT_INFLUENCE_TILE_CELL_NUM)
+
+// Layers of a map
+enum BOT_INFLUENCE
+{
+	BOT_INFLUENCE_DANGER = 0,							// Bullets, and the player's line of fire
+	BOT_INFLUENCE_OPPORTUNITY,							// Where the bot can hit the player from
+	BOT_INFLUENCE_NUM
+};
+
+/*
+Coarse grid of influences in [0, 1] over the playfield, one layer per
+BOT_INFLUENCE enum. Influences are not rebuilt every frame: what was there
+decays and spreads to the neighbor cells (BotInfluenceUpdate), then what
+moved this frame is stamped on top (BotInfluenceStamp). Along a straight
+path, an influence spreading from a cell loses a factor mSpread per cell
+and all of them lose mDecay per update, so the map keeps a fading memory
+of where the bullets and the player were, wider the older it is.
+The cells are stored by tiles of BOT_INFLUENCE_TILE x BOT_INFLUENCE_TILE,
+tile rows one after the other, so a cell and its neighbors share a few
+cache lines and a tile row is one or two vectors (FuzzyVec.h).
+A tile is live while one of its cells is not 0. Influences spread by one
+cell per update, so an update only computes the live tiles and their 4
+neighbors; every other tile stays 0.
+*/
+typedef struct BotInfluence
+{
+	float					mMinX, mMinY;
+	float					mCellSize;
+	int						mTileNumX, mTileNumY;
+	float					mDecay;										// Factor of every cell per update
+	float					mSpread;									// Factor from a cell to its neighbors per update
+
+	int						mCurrent;									// Layers read: mCells[mCurrent], mCells[!mCurrent] is written by the next update
+	float					mCells[2][BOT_INFLUENCE_NUM][BOT_INFLUENCE_CELL_NUM_MAX];
+	unsigned char			mLive[2][BOT_INFLUENCE_NUM][BOT_INFLUENCE_TILE_NUM_MAX];	// 1: the tile of mCells may have a cell that is not 0
+}BotInfluence;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function sets up pInfluence, all 0, over [minX, maxX] x [minY, maxY]
+with square cells of cellSize (larger if more than BOT_INFLUENCE_TILE_NUM_MAX
+tiles are needed). Points out of the bounds read the border cells
+*/
+void BotInfluenceInit(BotInfluence *pInfluence, float minX, float minY, float maxX, float maxY, float cellSize, float decay, float spread);
+
+/*
+This function decays and spreads every layer of pInfluence once:
+cell = mDecay * max(cell, mSpread * max of its 4 neighbors), over the live
+tiles and their neighbors only
+*/
+void BotInfluenceUpdate(BotInfluence *pInfluence);
+
+/*
+This function raises to value the cells of layer "layer" whose center is
+within radius of the segment from (x0, y0) to (x1, y1), plus half a cell
+*/
+void BotInfluenceStamp(BotInfluence *pInfluence, int layer, float x0, float y0, float x1, float y1, float radius, float value);
+
+/*
+This function returns the influence of layer "layer" in the cell of (x, y)
+*/
+float BotInfluenceSample(const BotInfluence *pInfluence, int layer, float x, float y);
+
+/*
+This function writes the influence of layer "layer" at (pX[p], pY[p]) to pOut[p] for every one of the pointNum points
+*/
+void BotInfluenceSampleBatch(const BotInfluence *pInfluence, int layer, const float *pX, const float *pY, int pointNum, float *pOut);
+
+#endif
@@ -0,0 +1,91 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotLod.h
+Purpose:		Header file for BotLod.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_LOD_H
+#define BOT_LOD_H
+
+#include "BotScheduler.h"
+
+// Behavior levels of detail, from the most to the least detailed
+enum BOT_LOD
+{
+	BOT_LOD_NEAR = 0,			// Every decision, full fuzzy inference
+	BOT_LOD_MID,				// Fewer decisions, full fuzzy inference
+	BOT_LOD_FAR,				// Fewest decisions, interpolated lookup table (FuzzySurface.h)
+	BOT_LOD_NUM
+};
+
+/*
+Settings of BotLod. A bot moves to the next level when its distance to the
+player goes past mDistance[level] + mHysteresis, and back once it is under
+mDistance[level - 1] - mHysteresis. A bot outside of the viewport by more
+than mViewportMargin is BOT_LOD_FAR, until it is back inside by as much
+*/
+typedef struct BotLodSettings
+{
+	float					mDistance[BOT_LOD_NUM - 1];			// Distance from the player where each level ends
+	float					mHysteresis;
+	float					mViewportMargin;
+	float					mIntervalScale[BOT_LOD_NUM];		// Interval between 2 decisions at each level, in scheduler intervals
+}BotLodSettings;
+
+/*
+Level of every bot, and how many bots ran and decided at each level
+*/
+typedef struct BotLod
+{
+	BotLodSettings			mSettings;
+	unsigned char			mDistanceLevel[BOT_SCHEDULER_AGENT_NUM_MAX];	// Level from the distance alone
+	unsigned char			mOffscreen[BOT_SCHEDULER_AGENT_NUM_MAX];
+	unsigned char			mLevel[BOT_SCHEDULER_AGENT_NUM_MAX];			// From BOT_LOD enum
+
+	unsigned int			mFrameBotNum[BOT_LOD_NUM];			// Current frame: bots at each level
+	unsigned int			mFrameDecisionNum[BOT_LOD_NUM];		// Current frame: decisions made at each level
+	unsigned int			mBotNum[BOT_LOD_NUM];				// Since BotLodInit, in bots x frames
+	unsigned int			mDecisionNum[BOT_LOD_NUM];
+	unsigned int			mFrameNum;
+}BotLod;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function fills pSettings with the default settings
+*/
+void BotLodDefaultSettings(BotLodSettings *pSettings);
+
+/*
+This function starts pLod with every bot at BOT_LOD_NEAR
+*/
+void BotLodInit(BotLod *pLod, const BotLodSettings *pSettings);
+
+/*
+This function clears the counters of the current frame of pLod
+*/
+void BotLodBeginFrame(BotLod *pLod);
+
+/*
+This function updates the level of bot "agent" from its distance to the
+player and from how far it is outside of the viewport (outside, negative
+inside), sets its decision interval in pScheduler and returns its level
+*/
+int BotLodUpdate(BotLod *pLod, BotScheduler *pScheduler, int agent, float distance, float outside);
+
+/*
+This function counts a decision of bot "agent" at its current level
+*/
+void BotLodCountDecision(BotLod *pLod, int agent);
+
+#endif
@@ -0,0 +1,66 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotPerception.h
+Purpose:		Header file for BotPerception.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_PERCEPTION_H
+#define BOT_PERCEPTION_H
+
+#include "BotScheduler.h"
+
+#define BOT_PERCEPTION_BOT_NUM_MAX		BOT_SCHEDULER_AGENT_NUM_MAX	// Maximum number of bots perceiving
+#define BOT_PERCEPTION_TARGET_NUM_MAX	4						// Maximum number of targets perceived by every bot
+
+/*
+What every bot perceives of every target, one array per quantity, indexed
+by [target][bot]. With the facing F of the bot and the offset D from the
+bot to the target:
+	offset   = D
+	distance = |D|
+	bearing  = cos and sin of the angle from F to D (counterclockwise),
+	           dot(F, D) / (|F| |D|) and cross(F, D) / (|F| |D|), both 0 if D is 0
+	lateral  = cross(F, D) / |F|, the signed distance from the target to the
+	           line the bot faces along (FindPlayer), > 0 to the left of F
+*/
+typedef struct BotPerception
+{
+	int						mBotNum;
+	int						mTargetNum;
+	float					mOffsetX[BOT_PERCEPTION_TARGET_NUM_MAX][BOT_PERCEPTION_BOT_NUM_MAX];
+	float					mOffsetY[BOT_PERCEPTION_TARGET_NUM_MAX][BOT_PERCEPTION_BOT_NUM_MAX];
+	float					mDistance[BOT_PERCEPTION_TARGET_NUM_MAX][BOT_PERCEPTION_BOT_NUM_MAX];
+	float					mBearingCos[BOT_PERCEPTION_TARGET_NUM_MAX][BOT_PERCEPTION_BOT_NUM_MAX];
+	float					mBearingSin[BOT_PERCEPTION_TARGET_NUM_MAX][BOT_PERCEPTION_BOT_NUM_MAX];
+	float					mLateral[BOT_PERCEPTION_TARGET_NUM_MAX][BOT_PERCEPTION_BOT_NUM_MAX];
+}BotPerception;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function fills pPerception for the botNum bots at (pBotX, pBotY)
+facing (pForwardX, pForwardY), and the targetNum targets at (pTargetX,
+pTargetY). Every target is one vectorized pass over the bots (FuzzyVec.h),
+with 2 square roots and no trigonometry. The facing vectors must not be 0
+*/
+void BotPerceptionUpdate(BotPerception *pPerception, const float *pBotX, const float *pBotY, const float *pForwardX, const float *pForwardY, int botNum,
+	const float *pTargetX, const float *pTargetY, int targetNum);
+
+/*
+This function returns the lateral offset of a single bot facing
+(forwardX, forwardY) from a target at (offsetX, offsetY) from it, as in
+BotPerception
+*/
+float BotPerceptionLateral(float forwardX, float forwardY, float offsetX, float offsetY);
+
+#endif
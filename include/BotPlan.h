@@ -0,0 +1,101 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotPlan.h
+Purpose:		Header file for BotPlan.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_PLAN_H
+#define BOT_PLAN_H
+
+#include "BotSim.h"
+#include "ThreadPool.h"
+
+#define BOT_PLAN_CANDIDATE_NUM_MAX	16					// Maximum number of heights compared per plan
+#define BOT_PLAN_ROLLOUT_NUM_MAX	64					// Maximum number of rollouts per height
+
+/*
+Settings of BotPlan
+*/
+typedef struct BotPlanSettings
+{
+	int						mCandidateNum;						// Heights compared, evenly spread over [mMinY, mMaxY]
+	int						mRolloutNum;						// Rollouts per height, each with its own random player
+	int						mFrameNum;							// Frames of a rollout
+	float					mBlend;								// Weight of the plan in the bot's height, the fuzzy output has the rest
+	float					mMinY, mMaxY;
+	int						mThreadNum;							// 0: one thread per processor
+}BotPlanSettings;
+
+/*
+Monte Carlo lookahead of the bot's height: every candidate height is held
+for mRolloutNum short headless matches (BotSim.h) from a snapshot of the
+game, the player scripted with its own random draws in each one, and the
+height with the best mean score (hits given minus hits taken) is blended
+with the fuzzy output. Ties go to the height closest to the fuzzy output,
+so a plan that sees nothing coming leaves the fuzzy bot alone.
+The rollouts run on a ThreadPool, interleaved so every height gets about
+as many rollouts when the deadline drops the last ones. Every rollout
+copies the snapshot and writes its own score, so they do not synchronize.
+*/
+typedef struct BotPlan
+{
+	BotPlanSettings			mSettings;
+	ThreadPool				mPool;
+
+	BotSimWorld				mSnapshot;							// World of the current plan
+	float					mCandidateY[BOT_PLAN_CANDIDATE_NUM_MAX];
+	float					mScore[BOT_PLAN_CANDIDATE_NUM_MAX * BOT_PLAN_ROLLOUT_NUM_MAX];	// Rollout r of candidate c: [r * mCandidateNum + c]
+	unsigned char			mDone[BOT_PLAN_CANDIDATE_NUM_MAX * BOT_PLAN_ROLLOUT_NUM_MAX];	// 0 if dropped at the deadline
+	double					mStart;								// BotSchedulerNow at the start of the plan
+	double					mDeadline;							// Microseconds of the plan, the rollouts not started by then are dropped
+
+	float					mBestY;								// Last plan: height found, and its mean score
+	float					mBestScore;
+	int						mPlanRolloutNum;					// Last plan: rollouts run, and dropped
+	int						mPlanDroppedNum;
+	double					mPlanTime;							// Last plan: microseconds
+	unsigned int			mPlanNum;							// Since BotPlanInit
+	unsigned int			mRolloutNum;
+	unsigned int			mDroppedNum;
+	double					mTimeMax;							// Longest plan, in microseconds
+}BotPlan;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function fills pSettings with the default settings, for heights in [minY, maxY]
+*/
+void BotPlanDefaultSettings(BotPlanSettings *pSettings, float minY, float maxY);
+
+/*
+This function sets up pPlan and starts its threads. Returns 0 if the
+threads cannot be created, in which case the rollouts run on the calling
+thread only. pPlan must not be moved once initialized (ThreadPool.h)
+*/
+int BotPlanInit(BotPlan *pPlan, const BotPlanSettings *pSettings);
+
+/*
+This function compares the candidate heights from pWorld, the bot's fuzzy
+output being fuzzyY, and returns the height the bot moves to: the best
+one blended with fuzzyY by mBlend, fuzzyY if no rollout ran. The rollouts
+not started deadline microseconds after the call are dropped, e.g. the
+budget left to the decisions of the frame (BotSchedulerBudgetLeft)
+*/
+float BotPlanRun(BotPlan *pPlan, const BotSimWorld *pWorld, float fuzzyY, double deadline);
+
+/*
+This function stops the threads of pPlan
+*/
+void BotPlanFree(BotPlan *pPlan);
+
+#endif
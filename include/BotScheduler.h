@@ -0,0 +1,107 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotScheduler.h
+Purpose:		Header file for BotScheduler.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_SCHEDULER_H
+#define BOT_SCHEDULER_H
+
+#define BOT_SCHEDULER_AGENT_NUM_MAX	4096				// Maximum number of bots of a scheduler
+
+/*
+Decision of one bot: called by BotSchedulerUpdate when the bot is due
+*/
+typedef void (*BotSchedulerDecide)(void *pContext, int agent);
+
+/*
+Runs the decisions of mAgentNum bots at a fixed rate, decoupled from the
+frame rate. Every bot decides once per mInterval seconds, or its own
+interval (BotSchedulerSetInterval), and the bots are staggered over the
+interval so only a fraction of them decide each frame.
+The decisions of a frame stop once they took mBudget microseconds: the
+bots left are deferred to the next frame, first in line. At least one
+decision is made per frame, so a budget too small only slows the rate.
+Between its decisions a bot moves toward its last target, blended from
+the previous one by BotSchedulerBlend.
+*/
+typedef struct BotScheduler
+{
+	int						mAgentNum;
+	float					mInterval;									// Seconds between 2 decisions of a bot
+	float					mAgentInterval[BOT_SCHEDULER_AGENT_NUM_MAX];	// Interval of each bot, mInterval unless changed
+	double					mBudget;									// Microseconds of decisions per frame
+	float					mAge[BOT_SCHEDULER_AGENT_NUM_MAX];			// Seconds since the last decision of each bot
+	int						mNext;										// First bot visited next frame
+	double					mFrameStart;								// BotSchedulerNow at the start of the last update
+
+	unsigned int			mFrameDecisionNum;							// Last frame: decisions made
+	unsigned int			mFrameDeferredNum;							// Last frame: due bots deferred
+	double					mFrameTime;									// Last frame: microseconds of decisions
+	unsigned int			mDecisionNum;								// Since BotSchedulerInit
+	unsigned int			mDeferredNum;
+	unsigned int			mFrameNum;
+	double					mTimeMax;									// Longest frame of decisions, in microseconds
+}BotScheduler;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function sets up pScheduler for agentNum bots (at most
+BOT_SCHEDULER_AGENT_NUM_MAX) deciding rate times per second, with budget
+microseconds of decisions per frame. Bot 0 is due at once, the others
+are spread over the first interval
+*/
+void BotSchedulerInit(BotScheduler *pScheduler, int agentNum, float rate, double budget);
+
+/*
+This function adds a bot to pScheduler, due after a fraction of an
+interval that keeps the bots added one by one spread over the interval.
+Returns its index, -1 if pScheduler is full
+*/
+int BotSchedulerAddAgent(BotScheduler *pScheduler);
+
+/*
+This function advances the bots of pScheduler by frameTime seconds and
+calls pDecide for the bots that are due, within the frame budget.
+Returns the number of decisions made
+*/
+int BotSchedulerUpdate(BotScheduler *pScheduler, float frameTime, BotSchedulerDecide pDecide, void *pContext);
+
+/*
+This function sets the interval between 2 decisions of bot "agent" to
+interval seconds, e.g. a multiple of mInterval for a bot that matters less.
+The time since its last decision is kept, so a shorter interval can make
+it due at once
+*/
+void BotSchedulerSetInterval(BotScheduler *pScheduler, int agent, float interval);
+
+/*
+This function returns how far bot "agent" is between its last 2
+decisions, from 0 right after the last one to 1 after a whole interval.
+The bot's target is previous + (last - previous) * blend
+*/
+float BotSchedulerBlend(const BotScheduler *pScheduler, int agent);
+
+/*
+This function returns the microseconds of the frame budget left, 0 once it
+is spent. Called from a decision, it is what that decision may still take
+*/
+double BotSchedulerBudgetLeft(const BotScheduler *pScheduler);
+
+/*
+This function returns the current time in microseconds, from an arbitrary origin
+*/
+double BotSchedulerNow(void);
+
+#endif
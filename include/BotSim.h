@@ -0,0 +1,101 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotSim.h
+Purpose:		Header file for BotSim.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_SIM_H
+#define BOT_SIM_H
+
+#include "Fuzzy.h"
+
+// Same values as GameState_Asteroids.c
+#define BOT_SIM_FRAME_TIME			(1.0f / 60.0f)		// Fixed time step of a simulated frame
+#define BOT_SIM_WIN_X				400.0f				// Half size of the window
+#define BOT_SIM_WIN_Y				300.0f
+#define BOT_SIM_SHIP_SIZE			60.0f
+#define BOT_SIM_BULLET_SPEED		700.0f
+#define BOT_SIM_BOT_STEP			3.5f				// Bot move per frame along each axis
+#define BOT_SIM_SHIP_STEP			5.0f				// Player move per frame along each axis
+#define BOT_SIM_AMMO_MAX			5
+#define BOT_SIM_RELOAD_TIME			2.5f				// Time to reload once the last bullet is fired
+#define BOT_SIM_DAMAGE				8.0f				// HP lost per bullet
+
+// Scripted behavior
+#define BOT_SIM_FIRE_DELAY			0.3f				// Shortest time between 2 shots of the same side
+#define BOT_SIM_BULLET_NUM_MAX		32
+
+/*
+Bullet, flying straight up (player) or down (bot)
+*/
+typedef struct BotSimBullet
+{
+	float					mX;
+	float					mY;
+	float					mVelocityY;
+}BotSimBullet;
+
+/*
+Headless match between the fuzzy bot and a scripted player, with the rules
+of GameStateAsteroidsUpdate: the bot moves 3.5 per frame towards the
+player's lateral offset (FindPlayer) and towards the height given by its
+fuzzy model (getFuzzyOutputY), both sides have 5 bullets and reload 2.5 s
+after the last one. Keyboard decisions are scripted instead: the bot fires
+when the player is in front of it, the player follows the bot to shoot it,
+sidesteps the bullets coming at it and wanders up and down. Everything
+random comes from mRandom, so a match only depends on its seed.
+The whole state is plain data: a copy is a snapshot of the match.
+*/
+typedef struct BotSimWorld
+{
+	float					mShipX, mShipY;
+	float					mBotX, mBotY;
+	float					mShipHP, mBotHP;
+	int						mShipAmmo, mBotAmmo;
+	float					mShipTimer, mBotTimer;				// Time since the last shot
+	float					mShipTargetY;						// Height the player wanders to
+	float					mShipOffsetX;						// Player's aiming error
+
+	int						mBulletNum;
+	BotSimBullet			mBullets[BOT_SIM_BULLET_NUM_MAX];
+
+	unsigned int			mRandom;
+	int						mFrame;
+	int						mShipHitNum;						// Bullets of the player that hit the bot
+	int						mBotHitNum;							// Bullets of the bot that hit the player
+}BotSimWorld;
+
+/*
+This function sets up a match in the starting positions of GameStateAsteroidsInit
+*/
+void BotSimInit(BotSimWorld *pWorld, unsigned int seed);
+
+/*
+This function runs one frame of the match, the bot following pModel
+(output clamped as in getFuzzyOutputY). Returns 0 once a side lost all its HP
+*/
+int BotSimStep(BotSimWorld *pWorld, const FuzzyModel *pModel);
+
+/*
+This function runs one frame of the match like BotSimStep, the bot moving
+toward the height targetY (clamped the same way) instead of its fuzzy output
+*/
+int BotSimStepTo(BotSimWorld *pWorld, float targetY);
+
+/*
+This function plays a match of at most frameNum frames and returns the
+score of the bot: hits given minus hits taken
+*/
+float BotSimPlay(const FuzzyModel *pModel, unsigned int seed, int frameNum);
+
+#endif
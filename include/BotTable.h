@@ -0,0 +1,98 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotTable.h
+Purpose:		Header file for BotTable.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_TABLE_H
+#define BOT_TABLE_H
+
+#include "BotScheduler.h"
+#include "FuzzyCache.h"
+
+#define BOT_TABLE_BOT_NUM_MAX		BOT_SCHEDULER_AGENT_NUM_MAX	// Maximum number of bots of a world
+#define BOT_TABLE_HP_MAX			100.0f				// HP of a new bot, and of a bot killed
+#define BOT_TABLE_AMMO_MAX			5					// Bullets of a full clip
+#define BOT_TABLE_RELOAD_TIME		2.5f				// Seconds from the last bullet to a full clip
+#define BOT_TABLE_DAMAGE			8.0f				// HP lost per bullet
+#define BOT_TABLE_STEP				3.5f				// Distance moved per frame along each axis
+
+/*
+State of every bot of a world, one array per quantity, indexed by bot.
+A bot's decision (BotScheduler.h) writes mTargetX and moves mTargetY to
+mFromY before writing the new fuzzy output in mTargetY; every frame the
+bot moves toward mTargetX, and toward mFromY blended to mTargetY.
+Every bot keeps its own incremental evaluation in mFuzzyCache, the inputs
+of different bots do not evict each other, and its own defuzzification
+(FuzzyCacheSetMamdani).
+*/
+typedef struct BotTable
+{
+	int						mBotNum;
+	float					mMinY, mMaxY;									// Range of the y targets
+
+	float					mX[BOT_TABLE_BOT_NUM_MAX];						// Position
+	float					mY[BOT_TABLE_BOT_NUM_MAX];
+	float					mForwardX[BOT_TABLE_BOT_NUM_MAX];				// Unit facing vector
+	float					mForwardY[BOT_TABLE_BOT_NUM_MAX];
+
+	float					mHP[BOT_TABLE_BOT_NUM_MAX];
+	int						mAmmo[BOT_TABLE_BOT_NUM_MAX];
+	float					mReloadTime[BOT_TABLE_BOT_NUM_MAX];			// Seconds since the clip ran out
+
+	float					mTargetX[BOT_TABLE_BOT_NUM_MAX];				// Last decision
+	float					mFromY[BOT_TABLE_BOT_NUM_MAX];					// Fuzzy output before the last one
+	float					mTargetY[BOT_TABLE_BOT_NUM_MAX];				// Last fuzzy output
+	FuzzyCache				mFuzzyCache[BOT_TABLE_BOT_NUM_MAX];				// Last evaluation of the decision model, set up by the caller (FuzzyCacheInit)
+}BotTable;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function empties pTable. The y targets of its bots will be clamped to [minY, maxY]
+*/
+void BotTableInit(BotTable *pTable, float minY, float maxY);
+
+/*
+This function adds a bot at (x, y) facing angle, with full HP and ammo,
+staying where it is until its first decision. Returns its index, -1 if
+pTable is full
+*/
+int BotTableAdd(BotTable *pTable, float x, float y, float angle);
+
+/*
+This function advances the reload timers of every bot by frameTime and
+refills the clips that have been empty for BOT_TABLE_RELOAD_TIME
+*/
+void BotTableReload(BotTable *pTable, float frameTime);
+
+/*
+This function takes a bullet from the clip of bot "bot". Returns 0 if the clip is empty
+*/
+int BotTableFire(BotTable *pTable, int bot);
+
+/*
+This function takes BOT_TABLE_DAMAGE HP from bot "bot". Returns 1 if it
+dies, in which case it is back to full HP
+*/
+int BotTableHit(BotTable *pTable, int bot);
+
+/*
+This function moves every bot one frame toward its targets: BOT_TABLE_STEP
+along x while further than a step, and along y toward mFromY blended to
+mTargetY by pScheduler (BotSchedulerBlend), snapping when closer than half
+a step. Bot b must be agent b of pScheduler
+*/
+void BotTableMove(BotTable *pTable, const BotScheduler *pScheduler);
+
+#endif
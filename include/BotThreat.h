@@ -0,0 +1,92 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotThreat.h
+Purpose:		Header file for BotThreat.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_THREAT_H
+#define BOT_THREAT_H
+
+#define BOT_THREAT_CELL_NUM_MAX		4096				// Maximum number of cells of a grid
+#define BOT_THREAT_BULLET_NUM_MAX	2048				// Maximum number of bullets of a grid, the others are ignored
+#define BOT_THREAT_ENTRY_NUM_MAX	32768				// Maximum number of (cell, bullet) pairs of a grid
+
+/*
+Uniform grid of the paths bullets sweep over the next mHorizon seconds.
+Every bullet is listed in each cell its path, widened by mRadius, overlaps,
+so the bullets that can pass within mRadius of a point are the ones listed
+in the cell of the point: a query costs the bullets of one cell, not all
+of them. The cells of a bullet are found from the bounding box of its path.
+Points and paths out of the grid bounds belong to the border cells.
+*/
+typedef struct BotThreatGrid
+{
+	float					mCellSizeMin;								// Cell size asked for
+	float					mRadius;									// Distance of a bullet that is a threat
+	float					mHorizon;									// Seconds a bullet path is swept over
+
+	float					mMinX, mMinY;								// Bounds of the last BotThreatGridBuild
+	float					mCellSize;									// Cell size of the last BotThreatGridBuild
+	int						mCellNumX, mCellNumY;
+
+	int						mBulletNum;
+	float					mX[BOT_THREAT_BULLET_NUM_MAX];				// Position and velocity of every bullet
+	float					mY[BOT_THREAT_BULLET_NUM_MAX];
+	float					mVelocityX[BOT_THREAT_BULLET_NUM_MAX];
+	float					mVelocityY[BOT_THREAT_BULLET_NUM_MAX];
+
+	int						mCellStart[BOT_THREAT_CELL_NUM_MAX + 1];	// Bullets of cell c: mEntries[mCellStart[c]] to mEntries[mCellStart[c + 1] - 1]
+	unsigned short			mEntries[BOT_THREAT_ENTRY_NUM_MAX];
+	int						mDroppedNum;								// Last build: bullets left out, their cells beyond BOT_THREAT_ENTRY_NUM_MAX
+}BotThreatGrid;
+
+/*
+Incoming fire of a point: the bullets passing within mRadius of it in the
+next mHorizon seconds, and how to avoid the first one
+*/
+typedef struct BotThreat
+{
+	int						mBulletNum;									// Bullets passing within mRadius
+	float					mTime;										// Seconds before the first one is within mRadius, mHorizon if none
+	float					mEscapeX, mEscapeY;							// Shortest move out of the path of the first one, 0 if none
+}BotThreat;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function sets up pGrid for bullets passing within radius of a point
+in the next horizon seconds, with square cells of cellSize
+*/
+void BotThreatGridInit(BotThreatGrid *pGrid, float cellSize, float radius, float horizon);
+
+/*
+This function fills pGrid with the bulletNum bullets at (pX, pY) moving at
+(pVelocityX, pVelocityY) per second, over the rectangle [minX, maxX] x
+[minY, maxY] (cells are made larger if it needs more than
+BOT_THREAT_CELL_NUM_MAX). Returns the number of bullets listed, the last
+ones are left out once their cells would not fit BOT_THREAT_ENTRY_NUM_MAX
+*/
+int BotThreatGridBuild(BotThreatGrid *pGrid, float minX, float minY, float maxX, float maxY,
+	const float *pX, const float *pY, const float *pVelocityX, const float *pVelocityY, int bulletNum);
+
+/*
+This function fills pThreat with the bullets of pGrid coming at (x, y).
+A bullet is within mRadius of the point when |D - V t| <= mRadius, with D
+the offset from the bullet to the point and V its velocity: the earliest
+such t in [0, mHorizon] is its time to impact. The escape is the move,
+perpendicular to the bullet, that leaves the point mRadius from its path
+on the side it already is
+*/
+void BotThreatQuery(const BotThreatGrid *pGrid, float x, float y, BotThreat *pThreat);
+
+#endif
@@ -0,0 +1,60 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotTune.h
+Purpose:		Header file for BotTune.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef BOT_TUNE_H
+#define BOT_TUNE_H
+
+#include "Fuzzy.h"
+#include <stdio.h>
+
+#define BOT_TUNE_PARENT_NUM_MAX		16					// Maximum number of rule bases kept from a generation to the next
+#define BOT_TUNE_CHILD_NUM_MAX		128					// Maximum number of rule bases tried per generation
+
+/*
+Settings of BotTune
+*/
+typedef struct BotTuneSettings
+{
+	int						mGenerationNum;
+	int						mParentNum;							// mu
+	int						mChildNum;							// lambda
+	int						mMatchNum;							// Matches played by every rule base, on the same seeds
+	int						mFrameNum;							// Length of a match
+	int						mThreadNum;							// 0: one thread per processor
+	float					mSigma;								// Starting mutation size, as a fraction of each domain
+	unsigned int			mSeed;
+}BotTuneSettings;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function fills pSettings with the default settings
+*/
+void BotTuneDefaultSettings(BotTuneSettings *pSettings);
+
+/*
+This function tunes the membership functions of the inputs and of the
+first output of pStart (the rules are kept) with a (mu + lambda) evolution
+strategy. Every rule base plays mMatchNum headless matches (BotSim.h); the
+matches of a generation run in parallel on a ThreadPool. The Sugeno
+consequents are not searched: FuzzyModelCompile derives them from the
+mutated output triangles. The best rule base found is written to pBest, its
+score returned. Progress goes to pLog if not 0, starting with the time of
+the first rule base's matches on 1 thread and on the whole pool
+*/
+float BotTune(FuzzyRuleBase *pBest, const FuzzyRuleBase *pStart, const BotTuneSettings *pSettings, FILE *pLog);
+
+#endif
@@ -0,0 +1,236 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		Fuzzy.h
+Purpose:		Header file for Fuzzy.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_H
+#define FUZZY_H
+
+#define FUZZY_INPUT_NUM_MAX			3					// Maximum number of inputs of a fuzzy system
+#define FUZZY_MF_NUM_MAX			8					// Maximum number of membership functions per input/output
+#define FUZZY_RULE_NUM_MAX			64					// Maximum number of rules of a fuzzy system
+#define FUZZY_OUTPUT_NUM_MAX		4					// Maximum number of outputs of a fuzzy system
+#define FUZZY_SEGMENT_NUM_MAX		(2 * FUZZY_MF_NUM_MAX)	// Maximum number of intervals between the feet of an input's membership functions
+#define FUZZY_CELL_NUM_MAX			(FUZZY_MF_NUM_MAX * FUZZY_MF_NUM_MAX * FUZZY_MF_NUM_MAX)	// Size of the antecedent grid
+
+#define FUZZY_NAME_LEN				16					// Maximum length of an input/output/membership function name, with the terminating 0
+
+#define FUZZY_SHOULDER_SLOPE		1.0e30f				// Slope used for the vertical edge of a shoulder (a == b or b == c)
+
+// ---------------------------------------------------------------------------
+
+/*
+Triangular membership function: 0 at "a", 1 at "b", 0 at "c" (a <= b <= c)
+*/
+typedef struct FuzzyTriangle
+{
+	float a, b, c;
+}FuzzyTriangle;
+
+// ---------------------------------------------------------------------------
+
+/*
+Authoring form of a fuzzy system, as designed in the Mamdani system:
+triangles of every input and of every output, and for each rule the
+membership function used for every input and the class of every output.
+The names are only used to read/write rule base files (FuzzyIO.h)
+*/
+typedef struct FuzzyRuleBase
+{
+	int						mInputNum;											// Number of inputs
+	int						mMfNum[FUZZY_INPUT_NUM_MAX];						// Number of membership functions of each input
+	FuzzyTriangle			mInputMf[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];	// Input membership functions
+	char					mInputName[FUZZY_INPUT_NUM_MAX][FUZZY_NAME_LEN];
+	char					mInputMfName[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX][FUZZY_NAME_LEN];
+
+	int						mOutputNum;											// Number of outputs
+	int						mOutputMfNum[FUZZY_OUTPUT_NUM_MAX];					// Number of classes of each output
+	FuzzyTriangle			mOutputMf[FUZZY_OUTPUT_NUM_MAX][FUZZY_MF_NUM_MAX];	// Output membership functions
+	char					mOutputName[FUZZY_OUTPUT_NUM_MAX][FUZZY_NAME_LEN];
+	char					mOutputMfName[FUZZY_OUTPUT_NUM_MAX][FUZZY_MF_NUM_MAX][FUZZY_NAME_LEN];
+
+	int						mRuleNum;											// Number of rules
+	int						mRuleMf[FUZZY_RULE_NUM_MAX][FUZZY_INPUT_NUM_MAX];	// Antecedent: membership function index for each input
+	int						mRuleOutput[FUZZY_RULE_NUM_MAX][FUZZY_OUTPUT_NUM_MAX];	// Consequent: class of each output
+}FuzzyRuleBase;
+
+// ---------------------------------------------------------------------------
+
+/*
+Compiled (Takagi-Sugeno) form of a fuzzy system. Everything that does not
+depend on the inputs is computed once by FuzzyModelCompile:
+- every triangle is stored as 2 ramps with precomputed reciprocal slopes,
+  mu = max(0, min((x - a) * InvL + BiasL, (c - x) * InvR + BiasR))
+- every rule stores one linear consequent per output, w = Coef . x + Const
+Rule data is stored as structure of arrays, indexed by rule. The firing
+strengths only depend on the antecedents, so they are shared by all the
+outputs: every extra output costs one dot product per firing rule.
+
+For the sparse evaluation, every input's domain is split in segments at the
+feet of its membership functions. Only the membership functions listed for
+the segment containing x can be non-zero. Rules are also indexed by their
+cell in the antecedent grid (one membership function per input), so the
+rules that can fire are found from the active membership functions alone.
+
+The output triangles and the class of every rule are kept as well, for the
+Mamdani evaluation (FuzzyModelEvaluateMamdani).
+*/
+typedef struct FuzzyModel
+{
+	int						mInputNum;
+	int						mMfNum[FUZZY_INPUT_NUM_MAX];
+
+	float					mMfA[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];		// Left foot
+	float					mMfC[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];		// Right foot
+	float					mMfInvL[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];		// 1 / (b - a)
+	float					mMfInvR[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];		// 1 / (c - b)
+	float					mMfBiasL[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];	// 1 for a left shoulder, 0 otherwise
+	float					mMfBiasR[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];	// 1 for a right shoulder, 0 otherwise
+
+	int						mRuleNum;
+	int						mOutputNum;
+	unsigned char			mRuleMf[FUZZY_INPUT_NUM_MAX][FUZZY_RULE_NUM_MAX];	// Antecedent membership function of each rule
+	float					mRuleCoef[FUZZY_OUTPUT_NUM_MAX][FUZZY_INPUT_NUM_MAX][FUZZY_RULE_NUM_MAX];	// Consequent coefficients (alpha, beta, gamma...) of each output
+	float					mRuleConst[FUZZY_OUTPUT_NUM_MAX][FUZZY_RULE_NUM_MAX];	// Consequent constant of each output
+
+	int						mSegNum[FUZZY_INPUT_NUM_MAX];										// Number of segments of each input
+	float					mSegBound[FUZZY_INPUT_NUM_MAX][FUZZY_SEGMENT_NUM_MAX + 1];			// Segment k is [mSegBound[k], mSegBound[k+1]]
+	unsigned char			mSegMfNum[FUZZY_INPUT_NUM_MAX][FUZZY_SEGMENT_NUM_MAX];				// Number of membership functions covering each segment
+	unsigned char			mSegMf[FUZZY_INPUT_NUM_MAX][FUZZY_SEGMENT_NUM_MAX][FUZZY_MF_NUM_MAX];	// Membership functions covering each segment
+
+	int						mCellStride[FUZZY_INPUT_NUM_MAX];					// Cell index = sum(mf_i * mCellStride[i])
+	unsigned short			mCellStart[FUZZY_CELL_NUM_MAX + 1];					// Rules of cell k: mCellRule[mCellStart[k]..mCellStart[k+1]-1]
+	unsigned char			mCellRule[FUZZY_RULE_NUM_MAX];
+
+	int						mOutputMfNum[FUZZY_OUTPUT_NUM_MAX];					// Mamdani form: number of classes of each output
+	float					mOutputA[FUZZY_OUTPUT_NUM_MAX][FUZZY_MF_NUM_MAX];	// Output triangles a b c
+	float					mOutputB[FUZZY_OUTPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	float					mOutputC[FUZZY_OUTPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	unsigned char			mRuleClass[FUZZY_OUTPUT_NUM_MAX][FUZZY_RULE_NUM_MAX];	// Consequent class of each rule
+}FuzzyModel;
+
+/*
+Membership state of one input of a FuzzyModel: the membership functions
+that can be non-zero at the input's value and their memberships (mMu is
+indexed by membership function, only the active entries are set).
+mActiveNum is 0 if the value is outside of every support
+*/
+typedef struct FuzzyInputState
+{
+	const unsigned char		*mpActive;							// Points into FuzzyModel::mSegMf
+	int						mActiveNum;
+	float					mMu[FUZZY_MF_NUM_MAX];
+}FuzzyInputState;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function builds the evaluation tables of pModel from the rule base pRuleBase.
+The Mamdani output triangles are converted to linear Sugeno consequents:
+coefficient of input i = (out.c - out.a) / (mf_i.c - mf_i.a)
+constant               = out.b - sum(coefficient_i * mf_i.b)
+*/
+void FuzzyModelCompile(FuzzyModel *pModel, const FuzzyRuleBase *pRuleBase);
+
+/*
+This function returns the weighted average of the rule consequents of the
+first output for the inputs pInputs (pModel->mInputNum values). Returns 0
+if no rule fires
+*/
+float FuzzyModelEvaluate(const FuzzyModel *pModel, const float *pInputs);
+
+/*
+Same result as FuzzyModelEvaluate, but only the membership functions of the
+segment containing each input are computed, and only the rules whose cells
+have a non-zero membership on every input are visited (at most 12 of the
+bot's 18 rules, usually 1 to 4)
+*/
+float FuzzyModelEvaluateSparse(const FuzzyModel *pModel, const float *pInputs);
+
+/*
+This function writes every output of pModel for the inputs pInputs to
+pOutputs (pModel->mOutputNum values). The rules that can fire are found
+and their firing strengths computed once, as in FuzzyModelEvaluateSparse,
+then each output only adds its consequent dot products. Outputs are 0 if
+no rule fires
+*/
+void FuzzyModelEvaluateOutputs(const FuzzyModel *pModel, const float *pInputs, float *pOutputs);
+
+/*
+Mamdani form of FuzzyModelEvaluateSparse, from the same firing rules: every
+output class is clipped at the strongest firing of its rules (max), and the
+result is the centroid of the clipped classes. A clipped triangle is a
+trapezoid, so its area and moment have a closed form and no sampling of the
+output domain is needed. Overlapping classes are summed (center of sums)
+rather than merged. Returns 0 if no rule fires. The trained Sugeno
+consequents (FuzzyTrain.h) are not used
+*/
+float FuzzyModelEvaluateMamdani(const FuzzyModel *pModel, const float *pInputs);
+
+/*
+This function computes the membership state of the input "input" of pModel at x
+*/
+void FuzzyModelInputState(const FuzzyModel *pModel, int input, float x, FuzzyInputState *pState);
+
+/*
+Same as FuzzyModelEvaluateOutputs, with the membership states of the inputs
+already computed by FuzzyModelInputState (pStates[i] must be the state of
+pInputs[i]). Lets a caller keep the states of inputs that did not change
+*/
+void FuzzyModelEvaluateStates(const FuzzyModel *pModel, const FuzzyInputState *pStates, const float *pInputs, float *pOutputs);
+
+/*
+Mamdani form of FuzzyModelEvaluateStates: every output of pModel is the
+centroid of its clipped classes, as in FuzzyModelEvaluateMamdani
+*/
+void FuzzyModelEvaluateStatesMamdani(const FuzzyModel *pModel, const FuzzyInputState *pStates, float *pOutputs);
+
+/*
+This function lists in pRules the rules of pModel whose cell only has
+active membership functions: ppActive[i] lists the pActiveNum[i] membership
+functions of input i that can be non-zero (a segment of mSegMf). Returns
+the number of rules, 0 if an input has none. Only the cell tables are read,
+so the fixed point model (FuzzyFixed.h) walks the rules the same way
+*/
+int FuzzyModelCellRules(const FuzzyModel *pModel, const unsigned char *const *ppActive, const int *pActiveNum, unsigned char *pRules);
+
+/*
+This function lists the rules of pModel that fire for pInputs in pRules
+and their normalized firing strengths (summing to 1) in pFiring, at most
+FUZZY_RULE_NUM_MAX of each. Returns the number of rules, 0 if none fires.
+Every output is the sum of pFiring[j] times the consequent of rule pRules[j]
+*/
+int FuzzyModelFiring(const FuzzyModel *pModel, const float *pInputs, unsigned char *pRules, float *pFiring);
+
+/*
+This function returns a hash of the compiled tables of pModel, used to
+detect data built from another rule base (FuzzyOctree.h)
+*/
+unsigned int FuzzyModelHash(const FuzzyModel *pModel);
+
+/*
+This function returns the membership of x in pMf with the branches of the
+game's original Triangle(). It is only kept as the reference of the
+compiled memberships (FuzzyMembership.h)
+*/
+float FuzzyTriangleEvaluate(const FuzzyTriangle *pMf, float x);
+
+/*
+This function evaluates the output "output" of pRuleBase directly,
+converting every rule to its Sugeno form on the fly. It is slow and is only
+kept as a reference to validate the compiled model against
+*/
+float FuzzyRuleBaseEvaluateReference(const FuzzyRuleBase *pRuleBase, const float *pInputs, int output);
+
+#endif
@@ -0,0 +1,40 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyBatch.h
+Purpose:		Header file for FuzzyBatch.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_BATCH_H
+#define FUZZY_BATCH_H
+
+#include "Fuzzy.h"
+
+/*
+This function evaluates pModel for num bots at once.
+ppInputs holds one array per input (ppInputs[i][bot]), pOutputs receives
+one output per bot. Bots are evaluated 8 at a time with AVX when the CPU
+has it (CPUID, checked on the first call), else 4 at a time with SSE2, and
+one at a time (FuzzyModelEvaluate) without SIMD and for the last bots.
+The AVX kernel is in FuzzyBatchAvx.c, the only file built with /arch:AVX.
+The rest of the project keeps SSE2: built with /arch:AVX, every vector
+loop (FuzzyVec.h) is AVX and the game needs an AVX CPU.
+Results match FuzzyModelEvaluate
+*/
+void FuzzyModelEvaluateBatch(const FuzzyModel *pModel, const float *const *ppInputs, float *pOutputs, int num);
+
+/*
+This function returns the name of the kernel FuzzyModelEvaluateBatch uses on this CPU ("AVX", "SSE2" or "scalar")
+*/
+const char *FuzzyBatchGetKernelName(void);
+
+#endif
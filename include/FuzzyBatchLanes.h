@@ -0,0 +1,82 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyBatchLanes.h
+Purpose:		Vector kernel of FuzzyModelEvaluateBatch
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+// No include guard: every file including it gets the kernel for its own
+// instruction set (FuzzyVec.h). FuzzyBatch.c includes it with the project's
+// instruction set, FuzzyBatchAvx.c with AVX
+
+#include "Fuzzy.h"
+
+/*
+This function evaluates the bots from 0 with the AVX kernel of
+FuzzyBatchAvx.c, 8 at a time, and returns how many it evaluated (a multiple
+of 8, 0 if the file was built without AVX). The CPU must have AVX
+*/
+int FuzzyModelEvaluateBatchAvx(const FuzzyModel *pModel, const float *const *ppInputs, float *pOutputs, int num);
+
+/*
+This function returns 1 if FuzzyBatchAvx.c was built with AVX
+*/
+int FuzzyBatchAvxIsBuilt(void);
+
+#if FUZZY_VEC_LANES > 1
+
+// Evaluates FUZZY_VEC_LANES bots starting at "first". Same operations, in
+// the same order, as FuzzyModelEvaluate, one bot per lane. Every rule is
+// evaluated: the antecedent indices are the same for all the lanes, so the
+// memberships are picked without any gather
+static __inline void FuzzyModelEvaluateLanes(const FuzzyModel *pModel, const float *const *ppInputs, float *pOutputs, int first)
+{
+	FuzzyVec x[FUZZY_INPUT_NUM_MAX];
+	FuzzyVec mu[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	FuzzyVec numerator = FuzzyVecSet1(0.0f), denominator = FuzzyVecSet1(0.0f), zero = FuzzyVecSet1(0.0f);
+	int i, m, r;
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		x[i] = FuzzyVecLoad(ppInputs[i] + first);
+
+		for (m = 0; m < pModel->mMfNum[i]; ++m)
+		{
+			FuzzyVec left = FuzzyVecAdd(FuzzyVecMul(FuzzyVecSub(x[i], FuzzyVecSet1(pModel->mMfA[i][m])),
+				FuzzyVecSet1(pModel->mMfInvL[i][m])), FuzzyVecSet1(pModel->mMfBiasL[i][m]));
+			FuzzyVec right = FuzzyVecAdd(FuzzyVecMul(FuzzyVecSub(FuzzyVecSet1(pModel->mMfC[i][m]), x[i]),
+				FuzzyVecSet1(pModel->mMfInvR[i][m])), FuzzyVecSet1(pModel->mMfBiasR[i][m]));
+
+			mu[i][m] = FuzzyVecMax(zero, FuzzyVecMin(left, right));
+		}
+	}
+
+	for (r = 0; r < pModel->mRuleNum; ++r)
+	{
+		FuzzyVec firing = mu[0][pModel->mRuleMf[0][r]];
+		FuzzyVec w = FuzzyVecAdd(FuzzyVecSet1(pModel->mRuleConst[0][r]), FuzzyVecMul(FuzzyVecSet1(pModel->mRuleCoef[0][0][r]), x[0]));
+
+		for (i = 1; i < pModel->mInputNum; ++i)
+		{
+			firing = FuzzyVecMin(firing, mu[i][pModel->mRuleMf[i][r]]);
+			w = FuzzyVecAdd(w, FuzzyVecMul(FuzzyVecSet1(pModel->mRuleCoef[0][i][r]), x[i]));
+		}
+
+		numerator = FuzzyVecAdd(numerator, FuzzyVecMul(firing, w));
+		denominator = FuzzyVecAdd(denominator, firing);
+	}
+
+	// Lanes where no rule fires get 0, like FuzzyModelEvaluate
+	FuzzyVecStore(pOutputs + first, FuzzyVecAnd(FuzzyVecGreater(denominator, zero), FuzzyVecDiv(numerator, denominator)));
+}
+
+#endif
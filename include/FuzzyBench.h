@@ -0,0 +1,44 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyBench.h
+Purpose:		Header file for FuzzyBench.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_BENCH_H
+#define FUZZY_BENCH_H
+
+#include "Fuzzy.h"
+#include "FuzzySurface.h"
+#include "FuzzyOctree.h"
+
+#define FUZZY_BENCH_SAMPLE_NUM		4096				// Number of random input triples evaluated per pass
+#define FUZZY_BENCH_PASS_NUM		256					// Number of passes over the samples
+#define FUZZY_BENCH_CACHE_EPSILON	0.5f				// Epsilon of the player input in the incremental evaluation timing
+#define FUZZY_BENCH_MEMO_STEP		2.0f				// Quantization step of the player input in the memo timing
+#define FUZZY_BENCH_MEMO_ENTRY_NUM	65536				// Entries of the memo timed
+#define FUZZY_BENCH_TRAIN_SAMPLE_NUM	(1 << 20)		// Samples of the training dataset
+#define FUZZY_BENCH_THREAT_BULLET_NUM	512				// Bullets of the threat query timing
+#define FUZZY_BENCH_INFLUENCE_BULLET_NUM	64				// Bullets stamped per frame of the influence map timing
+#define FUZZY_BENCH_TRAIN_FILE		"FuzzyBench.fzd"	// Training dataset, deleted afterwards
+
+/*
+This function times every fuzzy evaluator, lookup and bot query on the same
+random inputs of the bot's domain (FuzzyCheckSample) or simulated frames,
+next to the game's original evaluation, and prints the time per evaluation
+of each one. pSurface and pOctree are only timed if not 0. Their deviations
+are checked by FuzzyCheckRun ("-test"), not here. Build with FUZZY_BENCH
+defined to run it at load
+*/
+void FuzzyBenchRun(const FuzzyRuleBase *pRuleBase, const FuzzyModel *pModel, const FuzzySurface *pSurface, const FuzzyOctree *pOctree);
+
+#endif
@@ -0,0 +1,33 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyBotGenerated.h
+Purpose:		Header file for FuzzyBotGenerated.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_BOT_GENERATED_H
+#define FUZZY_BOT_GENERATED_H
+
+/*
+This function evaluates every output of the bot's rule base, as
+FuzzyModelEvaluateOutputs does. It is generated from Data/Bot.fzy by
+FuzzyModelGenerate (FuzzyCodegen.h): build with FUZZY_GENERATE defined and
+run the game once to rewrite src/FuzzyBotGenerated.c after changing the rules
+*/
+void FuzzyBotEvaluate(const float *pInputs, float *pOutputs);
+
+/*
+This function returns the FuzzyModelHash of the model FuzzyBotEvaluate was generated from
+*/
+unsigned int FuzzyBotEvaluateHash(void);
+
+#endif
@@ -0,0 +1,75 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyCache.h
+Purpose:		Header file for FuzzyCache.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_CACHE_H
+#define FUZZY_CACHE_H
+
+#include "Fuzzy.h"
+
+/*
+Incremental evaluation of a fuzzy model: the last inputs, their membership
+states and the outputs are kept. An input that moved by less than its
+epsilon keeps its cached value, so the result always matches the model
+evaluated on the cached inputs.
+- no input moved: the cached outputs are returned (hit)
+- some inputs moved: only their membership states are recomputed, the
+  rules are fired from the cached states of the others (partial)
+- first call or after FuzzyCacheInvalidate: everything is computed (miss)
+The outputs are the Sugeno form of the model, or the Mamdani centroids once
+FuzzyCacheSetMamdani turned them on.
+*/
+typedef struct FuzzyCache
+{
+	const FuzzyModel		*mpModel;
+	float					mEpsilon[FUZZY_INPUT_NUM_MAX];		// Smallest change of each input that is re-evaluated
+	int						mValid;								// 0 until the first evaluation
+	int						mMamdani;							// 1: the outputs are the Mamdani centroids (FuzzyModelEvaluateStatesMamdani)
+
+	float					mInputs[FUZZY_INPUT_NUM_MAX];		// Inputs the cached outputs were computed for
+	FuzzyInputState			mStates[FUZZY_INPUT_NUM_MAX];
+	float					mOutputs[FUZZY_OUTPUT_NUM_MAX];
+
+	unsigned int			mHitNum;
+	unsigned int			mPartialNum;
+	unsigned int			mMissNum;
+}FuzzyCache;
+
+/*
+This function sets pCache up for pModel, with the epsilon of every input in
+pEpsilon (0 re-evaluates any change, 0 for pEpsilon means 0 for every input).
+The counters are reset
+*/
+void FuzzyCacheInit(FuzzyCache *pCache, const FuzzyModel *pModel, const float *pEpsilon);
+
+/*
+This function forces the next evaluation to recompute everything, to be
+called when the model changes
+*/
+void FuzzyCacheInvalidate(FuzzyCache *pCache);
+
+/*
+This function picks the Mamdani centroids (mamdani 1) or the Sugeno form
+(mamdani 0) as the outputs of pCache. A change invalidates the cached outputs
+*/
+void FuzzyCacheSetMamdani(FuzzyCache *pCache, int mamdani);
+
+/*
+This function writes every output of the model for pInputs to pOutputs
+(mOutputNum values), re-evaluating only the inputs that moved past their epsilon
+*/
+void FuzzyCacheEvaluate(FuzzyCache *pCache, const float *pInputs, float *pOutputs);
+
+#endif
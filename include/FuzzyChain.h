@@ -0,0 +1,120 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyChain.h
+Purpose:		Header file for FuzzyChain.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_CHAIN_H
+#define FUZZY_CHAIN_H
+
+#include "Fuzzy.h"
+
+#define FUZZY_CHAIN_INPUT_NUM_MAX	16					// Maximum number of external inputs of a chain
+#define FUZZY_CHAIN_STAGE_NUM_MAX	8					// Maximum number of fuzzy systems of a chain
+#define FUZZY_CHAIN_VALUE_NUM_MAX	(FUZZY_CHAIN_INPUT_NUM_MAX + FUZZY_CHAIN_STAGE_NUM_MAX * FUZZY_OUTPUT_NUM_MAX)	// Inputs and stage outputs
+
+/*
+One fuzzy system of a chain. mSource[i] is the index, in the chain's
+values, of the value fed to input i of mModel. The outputs are written to
+the values from mOutputStart, clamped to the domain of their classes
+(mOutputMin, mOutputMax) so that a later stage always gets a value inside
+the membership functions it was designed for.
+*/
+typedef struct FuzzyChainStage
+{
+	FuzzyModel				mModel;
+	unsigned char			mSource[FUZZY_INPUT_NUM_MAX];
+	int						mOutputStart;
+	float					mOutputMin[FUZZY_OUTPUT_NUM_MAX];
+	float					mOutputMax[FUZZY_OUTPUT_NUM_MAX];
+}FuzzyChainStage;
+
+/*
+Hierarchical fuzzy system: small fuzzy systems (at most FUZZY_INPUT_NUM_MAX
+inputs each) where the outputs of a stage feed the inputs of the later ones.
+A full grid over n inputs of m membership functions needs m^n rules, a
+chain of 2-3 input stages only about m^3 per stage, so the rule count, the
+memory and the evaluation cost grow linearly with the number of inputs
+(6 inputs of 3 functions: 729 rules as one system, 54 as 2 chained stages).
+
+Every value of the chain has a name: the external inputs, then the outputs
+of every stage, in stage order. Stages are wired by name, an input of a
+stage reads the value with the same name, which must come before it.
+The last stage's first output is the output of the chain.
+
+Text chain format (.fzh), one statement per line, '#' starts a comment:
+
+	input BHP					<- external inputs, in the order of pInputs
+	input PHP
+	...
+	stage Data/Threat.fzy		<- rule base file (FuzzyIO.h), in evaluation order
+	stage Data/BotChain.fzy
+*/
+typedef struct FuzzyChain
+{
+	int						mInputNum;											// Number of external inputs
+	int						mValueNum;											// Inputs and stage outputs
+	char					mValueName[FUZZY_CHAIN_VALUE_NUM_MAX][FUZZY_NAME_LEN];
+
+	int						mStageNum;
+	FuzzyChainStage			mStages[FUZZY_CHAIN_STAGE_NUM_MAX];
+}FuzzyChain;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function starts an empty chain with the inputNum external inputs
+named pNames. Returns 1 on success, 0 on failure (too many inputs or a
+duplicate name), in which case FuzzyChainGetError describes the problem
+*/
+int FuzzyChainInit(FuzzyChain *pChain, int inputNum, const char (*pNames)[FUZZY_NAME_LEN]);
+
+/*
+This function compiles pRuleBase and appends it to pChain. Every input of
+pRuleBase must be named after an input of the chain or an output of an
+earlier stage, and its outputs must not reuse a name. Returns 1 on success,
+0 on failure
+*/
+int FuzzyChainAddStage(FuzzyChain *pChain, const FuzzyRuleBase *pRuleBase);
+
+/*
+This function loads pChain from the text chain file pFileName, loading
+every stage with FuzzyRuleBaseLoad. Returns 1 on success, 0 on failure
+*/
+int FuzzyChainLoad(FuzzyChain *pChain, const char *pFileName);
+
+/*
+This function returns the index of the value named pName in pChain, -1 if none
+*/
+int FuzzyChainFind(const FuzzyChain *pChain, const char *pName);
+
+/*
+This function evaluates every stage of pChain in order, in a single pass,
+for the external inputs pInputs (pChain->mInputNum values) and returns the
+chain's output. Stage outputs are clamped when they feed a later stage,
+the chain's output is not, as with FuzzyModelEvaluate
+*/
+float FuzzyChainEvaluate(const FuzzyChain *pChain, const float *pInputs);
+
+/*
+Same as FuzzyChainEvaluate, but every value of the chain is written to
+pValues (pChain->mValueNum values), e.g. to read an intermediate output
+*/
+void FuzzyChainEvaluateValues(const FuzzyChain *pChain, const float *pInputs, float *pValues);
+
+/*
+This function returns a description of the last failure
+*/
+const char *FuzzyChainGetError(void);
+
+#endif
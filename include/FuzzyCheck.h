@@ -0,0 +1,83 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyCheck.h
+Purpose:		Header file for FuzzyCheck.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_CHECK_H
+#define FUZZY_CHECK_H
+
+#include "FuzzyChain.h"
+#include <stdio.h>
+
+#define FUZZY_CHECK_SAMPLE_NUM		(1 << 16)			// Random inputs of the bot's domain every evaluator is checked on
+#define FUZZY_CHECK_TOLERANCE		1.0e-3f				// Largest deviation accepted between 2 evaluations of the same output
+#define FUZZY_CHECK_FIXED_TOLERANCE	0.1f				// Same, for the fixed point model (rounding of its inputs and slopes)
+#define FUZZY_CHECK_MAMDANI_STEP_NUM	1024			// Samples of the output domain in the sampled Mamdani centroid
+#define FUZZY_CHECK_BULLET_NUM		512					// Bullets of the threat and influence checks
+#define FUZZY_CHECK_ERROR_MAX		10.0f				// Error budget of the lookup table and the octree checked
+#define FUZZY_CHECK_RESOLUTION_MAX	513					// Largest number of samples along an input of the lookup table checked
+#define FUZZY_CHECK_DEPTH_MAX		8					// Largest depth of the octree checked
+
+/*
+This function checks every fuzzy evaluator and bot query against a slower
+reference on FUZZY_CHECK_SAMPLE_NUM random inputs of the bot's domain or
+random bots and bullets in an 800 x 600 viewport, and prints one line per
+check to pReport: its largest deviation, the bound it must stay within and
+"passed" or "FAILED". outMin and outMax are the range the game clamps the
+bot's height to. Returns the number of failed checks ("-test", main.c)
+*/
+int FuzzyCheckRun(const FuzzyRuleBase *pRuleBase, float outMin, float outMax, FILE *pReport);
+
+/*
+This function writes random inputs of the bot's domain to pInputs: HP in
+[0,100], ammo in {0..5} and |player Y| in [0,300]
+*/
+void FuzzyCheckSample(float *pInputs);
+
+/*
+This function writes the inputs of num consecutive frames of a simulated
+match to pInputs: HP drops every 512 frames, ammo every 64, and the player
+moves along a sine wave half of the time and stands still the other half
+*/
+void FuzzyCheckMatch(float (*pInputs)[FUZZY_INPUT_NUM_MAX], int num);
+
+/*
+This function writes num random positions in an 800 x 600 viewport centered
+on the origin to (pX, pY) and, if pVelocityX is not 0, velocities of the
+given speed in random directions to (pVelocityX, pVelocityY)
+*/
+void FuzzyCheckScatter(float *pX, float *pY, float *pVelocityX, float *pVelocityY, int num, float speed);
+
+/*
+This function makes pMulti a copy of pRuleBase with FUZZY_OUTPUT_NUM_MAX
+outputs: the first output's classes, shifted by one more class for every output
+*/
+void FuzzyCheckMultiOutput(FuzzyRuleBase *pMulti, const FuzzyRuleBase *pRuleBase);
+
+/*
+This function builds a 2 stage chain: pRuleBase, then pSecond, a copy of it
+reading the first stage's output in place of its last input.
+Returns 1 on success, 0 on failure (FuzzyChainGetError)
+*/
+int FuzzyCheckChain(FuzzyChain *pChain, FuzzyRuleBase *pSecond, const FuzzyRuleBase *pRuleBase);
+
+/*
+This function returns the Mamdani output of pRuleBase's first output by
+sampling the output domain in FUZZY_CHECK_MAMDANI_STEP_NUM steps: the sum of
+the classes, each clipped at the max firing of its rules, and its centroid
+(reference of FuzzyModelEvaluateMamdani)
+*/
+float FuzzyCheckMamdaniSampled(const FuzzyRuleBase *pRuleBase, const float *pInputs);
+
+#endif
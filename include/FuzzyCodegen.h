@@ -0,0 +1,40 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyCodegen.h
+Purpose:		Header file for FuzzyCodegen.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_CODEGEN_H
+#define FUZZY_CODEGEN_H
+
+#include "Fuzzy.h"
+
+/*
+This function writes to pFileName a C source file with 2 functions
+specialized for pModel:
+	void <pName>(const float *pInputs, float *pOutputs);
+	unsigned int <pName>Hash(void);
+The first one has the same result as FuzzyModelEvaluateOutputs, with the
+same segment and cell dispatch unrolled: the segment of every input is found
+by comparisons with its bounds, and a switch on the segments runs only the
+memberships and the rules that can fire there, with their constants written
+out. The minimum of the first 2 inputs is shared by the cells of the same
+pair. Nothing is looked up at run time, and the only division is the
+normalization by the sum of the firing strengths. The second one returns the FuzzyModelHash of pModel, to check
+that the generated code still matches the rule base.
+pHeaderName is #included by the file, and should declare both functions.
+Returns 1 on success, 0 if the file cannot be written
+*/
+int FuzzyModelGenerate(const FuzzyModel *pModel, const char *pName, const char *pHeaderName, const char *pFileName);
+
+#endif
@@ -0,0 +1,67 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyCompact.h
+Purpose:		Header file for FuzzyCompact.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_COMPACT_H
+#define FUZZY_COMPACT_H
+
+#include "Fuzzy.h"
+#include <stdio.h>
+
+#define FUZZY_COMPACT_CHECK_NUM		65					// Evenly spaced check points along a continuous input, the feet and tops are added
+
+/*
+Domain a rule base is analyzed and compacted over: the range of every input
+and the range the first output is clamped to, as for FuzzySurface.
+Inputs in mDiscreteMask only take integer values
+*/
+typedef struct FuzzyCompactDomain
+{
+	float					mMin[FUZZY_INPUT_NUM_MAX];
+	float					mMax[FUZZY_INPUT_NUM_MAX];
+	float					mOutMin;
+	float					mOutMax;
+	unsigned int			mDiscreteMask;
+}FuzzyCompactDomain;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function writes the coverage problems of pRuleBase over pDomain to
+pReport, one per line:
+- gaps: input values no membership function covers (no rule can fire,
+  the weighted average divides by 0)
+- uncovered regions: check points where no rule fires, grouped by the
+  strongest membership function of every input
+- repeated antecedents: rules firing exactly together (conflicting if
+  their classes differ)
+- mergeable rules: rules with the same classes differing on one input only
+Returns the number of problems found
+*/
+int FuzzyRuleBaseAnalyze(const FuzzyRuleBase *pRuleBase, const FuzzyCompactDomain *pDomain, FILE *pReport);
+
+/*
+This function writes to pReduced the rule base pRuleBase with as few rules
+as it can while its first output, clamped, stays within tolerance of the
+original one on a grid of check points over pDomain, and no check point
+the original covers is left without a firing rule. Each step applies the
+change with the smallest error among removing one rule and merging two
+mergeable rules into one whose membership function spans both of theirs.
+Unused membership functions are dropped at the end. Steps go to pReport
+if not 0. Returns the largest deviation of pReduced
+*/
+float FuzzyRuleBaseCompact(FuzzyRuleBase *pReduced, const FuzzyRuleBase *pRuleBase, const FuzzyCompactDomain *pDomain, float tolerance, FILE *pReport);
+
+#endif
@@ -0,0 +1,94 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyFixed.h
+Purpose:		Header file for FuzzyFixed.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_FIXED_H
+#define FUZZY_FIXED_H
+
+#include "Fuzzy.h"
+
+#ifndef FUZZY_FIXED_SHIFT
+#define FUZZY_FIXED_SHIFT			16					// Fraction bits of a FuzzyFixed (Q15.16 with the sign), can be set by the build
+#endif
+#define FUZZY_FIXED_ONE				(1 << FUZZY_FIXED_SHIFT)
+#define FUZZY_FIXED_SLOPE_SHIFT		24					// Fraction bits of the membership slopes (Q7.24), small slopes keep their precision
+
+/*
+Signed fixed point number with FUZZY_FIXED_SHIFT fraction bits
+*/
+typedef int FuzzyFixed;
+
+/*
+Fixed point form of a FuzzyModel. Evaluation only uses integer add, min,
+max, multiply (64 bit products) and shifts, and one integer division for
+the weighted average, so the result only depends on the tables: it is the
+same on every machine and compiler (with arithmetic right shifts of
+negative numbers, as MSVC, gcc and clang do). Only the rules that can
+fire are visited, listed by FuzzyModelCellRules from the segment and cell
+tables of the FuzzyModel it was compiled from.
+*/
+typedef struct FuzzyFixedModel
+{
+	int						mInputNum;
+	int						mMfNum[FUZZY_INPUT_NUM_MAX];
+
+	FuzzyFixed				mMfA[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];		// Left foot
+	FuzzyFixed				mMfC[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];		// Right foot
+	int						mMfInvL[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];		// Slopes, FUZZY_FIXED_SLOPE_SHIFT fraction bits (a vertical edge saturates to 128)
+	int						mMfInvR[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	FuzzyFixed				mMfBiasL[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	FuzzyFixed				mMfBiasR[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+
+	int						mRuleNum;
+	int						mOutputNum;
+	FuzzyFixed				mRuleCoef[FUZZY_OUTPUT_NUM_MAX][FUZZY_INPUT_NUM_MAX][FUZZY_RULE_NUM_MAX];
+	FuzzyFixed				mRuleConst[FUZZY_OUTPUT_NUM_MAX][FUZZY_RULE_NUM_MAX];
+
+	// Segment bounds in fixed point, the membership functions of the segments
+	// and the cells are the integer tables of the FuzzyModel
+	int						mSegNum[FUZZY_INPUT_NUM_MAX];
+	FuzzyFixed				mSegBound[FUZZY_INPUT_NUM_MAX][FUZZY_SEGMENT_NUM_MAX + 1];
+	const FuzzyModel		*mpModel;
+}FuzzyFixedModel;
+
+/*
+These functions convert between float and fixed point. FuzzyFixedFromFloat
+rounds to the nearest value and saturates
+*/
+FuzzyFixed FuzzyFixedFromFloat(float x);
+float FuzzyFixedToFloat(FuzzyFixed x);
+
+/*
+This function converts the compiled model pModel to fixed point. The float
+tables only come from IEEE basic operations, so the conversion gives the
+same tables on every machine. pModel must outlive pFixed, its segment and
+cell tables are used by FuzzyFixedModelEvaluate
+*/
+void FuzzyFixedModelCompile(FuzzyFixedModel *pFixed, const FuzzyModel *pModel);
+
+/*
+This function writes every output of pFixed for pInputs to pOutputs, as
+FuzzyModelEvaluateOutputs does. Outputs are 0 if no rule fires
+*/
+void FuzzyFixedModelEvaluate(const FuzzyFixedModel *pFixed, const FuzzyFixed *pInputs, FuzzyFixed *pOutputs);
+
+/*
+This function returns the signed distance from the line through the origin
+along pForward to the point pOffset, positive when pOffset is counterclockwise
+from pForward: cross(pForward, pOffset) / |pForward|. Returns 0 for a null pForward
+*/
+FuzzyFixed FuzzyFixedLateral(const FuzzyFixed *pForward, const FuzzyFixed *pOffset);
+
+#endif
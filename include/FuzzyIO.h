@@ -0,0 +1,67 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyIO.h
+Purpose:		Header file for FuzzyIO.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_IO_H
+#define FUZZY_IO_H
+
+#include "Fuzzy.h"
+
+#define FUZZY_BINARY_MAGIC			"FZYB"				// First 4 bytes of a compiled rule base file
+#define FUZZY_BINARY_VERSION		2
+
+/*
+Text rule base format (.fzy), one statement per line, '#' starts a comment:
+
+	input BHP
+	mf LO 0 0 50				<- name a b c, belongs to the last input/output
+	...
+	output BBH
+	mf OF 0 0 150
+	...
+	if BHP is LO and BAM is LO and PBH is OF then BBH is DF
+
+Inputs come first, then the outputs, then the rules. Every rule names one
+membership function for every input and one class for every output, in
+any order ("then BBH is DF and FIRE is NO").
+
+Binary rule base format (.fzb), little endian:
+	"FZYB", version (u32), input count (u8), output count (u8), rule count (u8), 0 (u8)
+	for every input: name (16 bytes), mf count (u8), then per mf: name (16 bytes), a b c (f32)
+	for every output: name (16 bytes), class count (u8), then per class: name (16 bytes), a b c (f32)
+	for every rule: mf index of every input (u8), class of every output (u8)
+Version 1 files (single output, class count in place of the output count
+and no class count after the output name) are still read.
+*/
+
+/*
+This function loads pRuleBase from the file pFileName, in text or binary
+form (detected from the first bytes). Returns 1 on success, 0 on failure,
+in which case FuzzyIOGetError describes the problem
+*/
+int FuzzyRuleBaseLoad(FuzzyRuleBase *pRuleBase, const char *pFileName);
+
+/*
+These functions write pRuleBase to the file pFileName. Return 1 on success, 0 on failure
+*/
+int FuzzyRuleBaseSaveText(const FuzzyRuleBase *pRuleBase, const char *pFileName);
+int FuzzyRuleBaseSaveBinary(const FuzzyRuleBase *pRuleBase, const char *pFileName);
+
+/*
+This function returns a description of the last load/save failure
+*/
+const char *FuzzyIOGetError(void);
+
+#endif
@@ -0,0 +1,108 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyMembership.h
+Purpose:		Header file for FuzzyMembership.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_MEMBERSHIP_H
+#define FUZZY_MEMBERSHIP_H
+
+#include "Fuzzy.h"
+
+// Shapes of membership functions
+enum FUZZY_MF_TYPE
+{
+	FUZZY_MF_TRIANGLE = 0,		// 0 at p0, 1 at p1, 0 at p2
+	FUZZY_MF_TRAPEZOID,			// 0 at p0, 1 from p1 to p2, 0 at p3
+	FUZZY_MF_SHOULDER_LEFT,		// 1 up to p0, 0 from p1
+	FUZZY_MF_SHOULDER_RIGHT,	// 0 up to p0, 1 from p1
+	FUZZY_MF_GAUSSIAN,			// exp(-(x - p0)^2 / (2 p1^2)), p1 = standard deviation
+	FUZZY_MF_SIGMOID,			// 1 / (1 + exp(-p1 (x - p0))), p1 = slope (< 0 falls)
+	FUZZY_MF_TYPE_NUM
+};
+
+/*
+Membership function, as authored
+*/
+typedef struct FuzzyMf
+{
+	int						mType;									// From FUZZY_MF_TYPE enum
+	float					mParam[4];
+}FuzzyMf;
+
+/*
+Membership functions of one input, compiled for evaluation at once.
+Triangles, trapezoids and shoulders are all 2 ramps clamped to [0,1]:
+mu = max(0, min(1, (x - A) * InvL + BiasL, (D - x) * InvR + BiasR))
+A vertical edge gets FUZZY_SHOULDER_SLOPE and a bias of 1, an open side
+(shoulder) a slope of 0 and a bias of 1. Every function goes through the
+ramps, then the few smooth ones (gaussian, sigmoid) are overwritten.
+*/
+typedef struct FuzzyMfSet
+{
+	int						mNum;
+	float					mA[FUZZY_MF_NUM_MAX];					// Left foot
+	float					mInvL[FUZZY_MF_NUM_MAX];				// 1 / (left top - A)
+	float					mBiasL[FUZZY_MF_NUM_MAX];
+	float					mD[FUZZY_MF_NUM_MAX];					// Right foot
+	float					mInvR[FUZZY_MF_NUM_MAX];				// 1 / (D - right top)
+	float					mBiasR[FUZZY_MF_NUM_MAX];
+
+	int						mSmoothNum;								// Number of gaussians and sigmoids
+	unsigned char			mSmoothMf[FUZZY_MF_NUM_MAX];			// Their index in the set
+	unsigned char			mType[FUZZY_MF_NUM_MAX];
+	float					mCenter[FUZZY_MF_NUM_MAX];
+	float					mScale[FUZZY_MF_NUM_MAX];				// Gaussian: -1 / (2 sigma^2), sigmoid: -slope
+}FuzzyMfSet;
+
+// ---------------------------------------------------------------------------
+
+/*
+These functions return a membership function of the given shape (see FUZZY_MF_TYPE)
+*/
+FuzzyMf FuzzyMfTriangle(float a, float b, float c);
+FuzzyMf FuzzyMfTrapezoid(float a, float b, float c, float d);
+FuzzyMf FuzzyMfShoulderLeft(float top, float foot);
+FuzzyMf FuzzyMfShoulderRight(float foot, float top);
+FuzzyMf FuzzyMfGaussian(float center, float sigma);
+FuzzyMf FuzzyMfSigmoid(float center, float slope);
+
+/*
+This function returns the membership of x in pMf. pMf is compiled on every
+call, use a FuzzyMfSet to evaluate the same functions repeatedly
+*/
+float FuzzyMfEvaluate(const FuzzyMf *pMf, float x);
+
+/*
+This function compiles the num membership functions pMfs (at most FUZZY_MF_NUM_MAX)
+*/
+void FuzzyMfSetCompile(FuzzyMfSet *pSet, const FuzzyMf *pMfs, int num);
+
+/*
+This function compiles num triangles of a rule base (FuzzyRuleBase::mInputMf).
+A triangle with a == b or b == c has a vertical edge, as in the rule base files
+*/
+void FuzzyMfSetCompileTriangles(FuzzyMfSet *pSet, const FuzzyTriangle *pTriangles, int num);
+
+/*
+This function writes the membership of x in every function of pSet to pMu (pSet->mNum values)
+*/
+void FuzzyMfSetEvaluate(const FuzzyMfSet *pSet, float x, float *pMu);
+
+/*
+This function evaluates every function of pSet on the num inputs pX.
+The membership of pX[j] in function m is written to pMu[m * num + j]
+*/
+void FuzzyMfSetEvaluateArray(const FuzzyMfSet *pSet, const float *pX, int num, float *pMu);
+
+#endif
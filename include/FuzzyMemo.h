@@ -0,0 +1,104 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyMemo.h
+Purpose:		Header file for FuzzyMemo.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_MEMO_H
+#define FUZZY_MEMO_H
+
+#include "Fuzzy.h"
+
+#define FUZZY_MEMO_SHARD_NUM_MAX	16					// Maximum number of shards (one per thread using the memo)
+#define FUZZY_MEMO_PROBE_NUM		8					// Slots searched from the home slot of a key before one is replaced
+#define FUZZY_MEMO_KEY_BITS			20					// Bits of each quantized input in a key
+
+/*
+Slot of a memo table. mKey is 0 for an empty slot: keys always have their top bit set
+*/
+typedef struct FuzzyMemoEntry
+{
+	unsigned long long		mKey;								// Quantized inputs, FUZZY_MEMO_KEY_BITS each
+	float					mOutput;
+}FuzzyMemoEntry;
+
+/*
+Table used by one thread, padded to a cache line so that the counters of
+2 threads never share one
+*/
+typedef struct FuzzyMemoShard
+{
+	FuzzyMemoEntry			*mpEntries;
+	unsigned int			mHitNum;
+	unsigned int			mMissNum;
+	char					mPad[64 - sizeof(FuzzyMemoEntry *) - 2 * sizeof(unsigned int)];
+}FuzzyMemoShard;
+
+/*
+Memoized output of a fuzzy model, clamped to the range the game uses.
+Inputs are rounded to a multiple of their step, and the model is evaluated
+on the rounded inputs: every input in the same cell gets the same output,
+whichever was seen first, and the error is the one of a nearest neighbor
+lookup on a grid of that step. A step of 1 keeps integer inputs (ammo) exact.
+Each shard is a fixed size open addressing table (linear probing), allocated
+once by FuzzyMemoInit. A thread only uses its own shard, so no lock is
+needed and nothing is allocated when evaluating. When all the probed slots
+are taken, the home slot of the key is replaced.
+*/
+typedef struct FuzzyMemo
+{
+	const FuzzyModel		*mpModel;
+	float					mStep[FUZZY_INPUT_NUM_MAX];			// Quantization step of each input
+	float					mInvStep[FUZZY_INPUT_NUM_MAX];
+	float					mOutMin;							// Range the model output is clamped to
+	float					mOutMax;
+
+	unsigned int			mEntryMask;							// Entries per shard - 1 (power of 2)
+	int						mShardNum;
+	FuzzyMemoShard			mShards[FUZZY_MEMO_SHARD_NUM_MAX];
+}FuzzyMemo;
+
+/*
+This function sets up a memo of pModel, clamped to [outMin, outMax], with
+the quantization step pStep[i] of every input, shardNum shards (at most
+FUZZY_MEMO_SHARD_NUM_MAX) of entryNum entries each (rounded up to a power of 2).
+The memory used is shardNum * entryNum * sizeof(FuzzyMemoEntry).
+pMemo must be zeroed or hold a previous memo, which is freed.
+Returns 1 on success, 0 if memory runs out
+*/
+int FuzzyMemoInit(FuzzyMemo *pMemo, const FuzzyModel *pModel, const float *pStep, float outMin, float outMax,
+	int entryNum, int shardNum);
+
+/*
+This function returns the clamped output of the model for pInputs rounded to
+the steps, from the shard "shard" if it was already computed
+*/
+float FuzzyMemoEvaluate(FuzzyMemo *pMemo, int shard, const float *pInputs);
+
+/*
+This function empties every shard and resets the counters
+*/
+void FuzzyMemoClear(FuzzyMemo *pMemo);
+
+/*
+This function returns the hits and misses of all the shards. Only call it
+when no thread is evaluating
+*/
+void FuzzyMemoGetStats(const FuzzyMemo *pMemo, unsigned int *pHitNum, unsigned int *pMissNum);
+
+/*
+This function frees the shards
+*/
+void FuzzyMemoFree(FuzzyMemo *pMemo);
+
+#endif
@@ -0,0 +1,112 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyOctree.h
+Purpose:		Header file for FuzzyOctree.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_OCTREE_H
+#define FUZZY_OCTREE_H
+
+#include "Fuzzy.h"
+
+#define FUZZY_OCTREE_MAGIC			"FZYO"				// First 4 bytes of an octree file
+#define FUZZY_OCTREE_VERSION		1
+#define FUZZY_OCTREE_LEAF			0x80000000u			// Node flag: the node is a leaf, the other bits index its corners
+#define FUZZY_OCTREE_CHECK_NUM		3					// Error check points between 2 breakpoints of the model, per input and per cell (continuous inputs)
+
+/*
+Header of an octree, followed in memory and on disk by
+- mNodeNum nodes (u32): first child index (the 8 children are contiguous,
+  child k covers the upper half of input i if bit i of k is set), or
+  FUZZY_OCTREE_LEAF | leaf index
+- mLeafNum leaves: 8 corner values (f32) each, corner k at the upper end of
+  input i if bit i of k is set
+Only 4 byte fields, no pointers: the whole block can be written as is and
+memory mapped back.
+*/
+typedef struct FuzzyOctreeHeader
+{
+	char					mMagic[4];
+	unsigned int			mVersion;
+	unsigned int			mModelHash;							// FuzzyModelHash of the model the octree was built from
+	unsigned int			mNodeNum;
+	unsigned int			mLeafNum;
+	unsigned int			mDepth;								// Depth of the deepest leaf (root = 0)
+	float					mMin[FUZZY_INPUT_NUM_MAX];			// Domain covered by the root
+	float					mMax[FUZZY_INPUT_NUM_MAX];
+	float					mOutMin;							// Range the model output is clamped to
+	float					mOutMax;
+	float					mMaxError;							// Largest error bound of the leaves (see FuzzyOctreeBuild)
+}FuzzyOctreeHeader;
+
+/*
+Adaptive lookup table of a fuzzy model's clamped output: cells are split in
+8 only where trilinear interpolation of their corners is further than the
+threshold from the model.
+*/
+typedef struct FuzzyOctree
+{
+	const FuzzyOctreeHeader	*mpHeader;							// Start of the block (built or mapped)
+	const unsigned int		*mpNodes;
+	const float				*mpLeaves;
+
+	float					mInvSize[FUZZY_INPUT_NUM_MAX];		// 1 / (mMax - mMin), 0 for inputs the model does not have
+
+	void					*mpFile;							// Memory mapping handles, 0 for a built octree
+	void					*mpMapping;
+}FuzzyOctree;
+
+/*
+This function builds the octree of pModel clamped to [outMin, outMax] over
+[pMin[i], pMax[i]]. Cells are split while their error is above maxError,
+down to maxDepth. The error of a cell is checked on the breakpoints of the
+model inside it and FUZZY_OCTREE_CHECK_NUM points between 2 of them, and
+widened by half the change of the error between neighbor points, as the
+model also bends between the breakpoints where memberships cross. Inputs in discreteMask only take integer values: their
+domain is widened to a power of 2 so that cell corners fall on integers,
+and the error is only checked on integers.
+pTree must be zeroed or hold a previous octree, which is freed.
+Returns 1 on success, 0 if memory runs out
+*/
+int FuzzyOctreeBuild(FuzzyOctree *pTree, const FuzzyModel *pModel, const float *pMin, const float *pMax,
+	float outMin, float outMax, unsigned int discreteMask, float maxError, int maxDepth);
+
+/*
+This function returns the interpolated output of the octree at pInputs.
+Inputs are clamped to the domain
+*/
+float FuzzyOctreeEvaluate(const FuzzyOctree *pTree, const float *pInputs);
+
+/*
+This function writes the octree block to pFileName. Returns 1 on success, 0 on failure
+*/
+int FuzzyOctreeSave(const FuzzyOctree *pTree, const char *pFileName);
+
+/*
+This function memory maps the octree file pFileName (read only). Every node
+is checked to index a leaf or children within the block before the octree
+is used. Returns 1 on success, 0 if the file is missing or invalid
+*/
+int FuzzyOctreeLoad(FuzzyOctree *pTree, const char *pFileName);
+
+/*
+This function returns the size of the octree block in bytes
+*/
+unsigned int FuzzyOctreeGetBytes(const FuzzyOctree *pTree);
+
+/*
+This function frees or unmaps the octree
+*/
+void FuzzyOctreeFree(FuzzyOctree *pTree);
+
+#endif
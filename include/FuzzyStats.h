@@ -0,0 +1,102 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyStats.h
+Purpose:		Header file for FuzzyStats.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_STATS_H
+#define FUZZY_STATS_H
+
+#include "Fuzzy.h"
+
+#define FUZZY_STATS_BIN_NUM			8					// Bins of the firing strength histograms, over ]0,1]
+#define FUZZY_STATS_THREAD_NUM_MAX	64					// Threads recording at the same time, as many as a ThreadPool (THREAD_POOL_THREAD_NUM_MAX)
+
+/*
+Rule statistics are only recorded when built with FUZZY_STATS defined.
+Otherwise FUZZY_STATS_RECORD expands to nothing and the evaluators are
+unchanged. Instrumented: FuzzyModelEvaluateSparse, FuzzyModelEvaluateOutputs
+and FuzzyModelEvaluateStates (and so FuzzyCache and FuzzyMemo misses).
+Lookup tables, the generated evaluator and the fixed point model have no
+rules left to count. FuzzyCache and FuzzyMemo hits return an earlier
+evaluation and are not counted again (FuzzyStatsSave says so).
+*/
+#ifdef FUZZY_STATS
+#define FUZZY_STATS_RECORD(pModel, pRules, pFiring, pWeights, num, denominator)	FuzzyStatsRecord(pModel, pRules, pFiring, pWeights, num, denominator)
+#else
+#define FUZZY_STATS_RECORD(pModel, pRules, pFiring, pWeights, num, denominator)
+#endif
+
+/*
+Counters of one thread, or totals. Contributions are those of the first
+output: normalized firing strength times the rule's consequent
+*/
+typedef struct FuzzyStatsCounters
+{
+	double					mEvaluationNum;
+	double					mNoFireNum;											// Evaluations where no rule fires
+	double					mFireNum[FUZZY_RULE_NUM_MAX];						// Evaluations where the rule fires
+	double					mStrength[FUZZY_RULE_NUM_MAX];						// Sum of normalized firing strengths
+	double					mContribution[FUZZY_RULE_NUM_MAX];					// Sum of contributions to the output
+	double					mContributionAbs[FUZZY_RULE_NUM_MAX];				// Sum of |contributions|
+	unsigned int			mHistogram[FUZZY_RULE_NUM_MAX][FUZZY_STATS_BIN_NUM];	// Firing strengths (not normalized)
+}FuzzyStatsCounters;
+
+/*
+Statistics of one model. Every thread adds to its own counters, without
+synchronization; FuzzyStatsMerge adds them to the totals once a frame,
+while no thread records.
+*/
+typedef struct FuzzyStats
+{
+	const FuzzyModel		*mpModel;
+	FuzzyStatsCounters		mTotal;
+	FuzzyStatsCounters		mThread[FUZZY_STATS_THREAD_NUM_MAX];
+}FuzzyStats;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function clears pStats and records the evaluations of pModel in it
+from now on (one model at a time, pStats = 0 stops recording)
+*/
+void FuzzyStatsAttach(FuzzyStats *pStats, const FuzzyModel *pModel);
+
+/*
+This function sets the counters the calling thread records to (0 by
+default), e.g. the thread index of a ThreadPoolTask. Every thread that
+evaluates models while another one does must call it with its own index
+*/
+void FuzzyStatsSetThread(int thread);
+
+/*
+This function adds one evaluation to the counters of the calling thread:
+the num rules pRules fire with the strengths pFiring (not normalized, sum
+denominator) and have the consequents pWeights. Called by FUZZY_STATS_RECORD
+*/
+void FuzzyStatsRecord(const FuzzyModel *pModel, const unsigned char *pRules, const float *pFiring, const float *pWeights, int num, float denominator);
+
+/*
+This function adds the counters of every thread to the totals and clears them
+*/
+void FuzzyStatsMerge(FuzzyStats *pStats);
+
+/*
+This function writes the totals to the text file pFileName, one entry per
+rule of pRuleBase (which pStats' model was compiled from), rules that never
+fired flagged as dead. Returns the number of dead rules, -1 if the file
+cannot be written
+*/
+int FuzzyStatsSave(const FuzzyStats *pStats, const FuzzyRuleBase *pRuleBase, const char *pFileName);
+
+#endif
@@ -0,0 +1,95 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzySurface.h
+Purpose:		Header file for FuzzySurface.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_SURFACE_H
+#define FUZZY_SURFACE_H
+
+#include "Fuzzy.h"
+
+#define FUZZY_SURFACE_CHECK_NUM		1					// Error check points between 2 breakpoints of the model, per cell of a continuous input
+
+/*
+Control surface of a fuzzy model: its output, clamped to the range the
+game uses, sampled on a regular grid over the input domain and queried by
+trilinear interpolation. The raw output is very steep where all the firing
+strengths are small, the clamped one is what the interpolation must follow.
+Samples are stored with the first input varying fastest. Inputs the model
+does not have get a resolution of 1
+*/
+typedef struct FuzzySurface
+{
+	int						mResolution[FUZZY_INPUT_NUM_MAX];	// Number of samples along each input (>= 2 for the model's inputs)
+	float					mMin[FUZZY_INPUT_NUM_MAX];			// Domain of each input
+	float					mMax[FUZZY_INPUT_NUM_MAX];
+	float					mOutMin;							// Range the model output is clamped to
+	float					mOutMax;
+	unsigned int			mDiscreteMask;						// Bit i set: input i only takes the sample values (e.g. the integer ammo count)
+	float					mInvStep[FUZZY_INPUT_NUM_MAX];		// (mResolution - 1) / (mMax - mMin)
+	int						mStride[FUZZY_INPUT_NUM_MAX];		// Distance between 2 samples along each input
+	float					*mpSamples;
+
+	float					mMaxError;							// Bound of the deviation from the model, from FuzzySurfaceMeasureError
+}FuzzySurface;
+
+/*
+This function samples pModel, clamped to [outMin, outMax], on a grid of
+pResolution[i] points spanning [pMin[i], pMax[i]] along each input, and
+measures the approximation error. Inputs in discreteMask are only checked
+on their samples.
+pSurface must be zeroed or hold a previous surface, which is freed.
+Returns 1 on success, 0 if the samples cannot be allocated
+*/
+int FuzzySurfaceBuild(FuzzySurface *pSurface, const FuzzyModel *pModel, const float *pMin, const float *pMax, const int *pResolution,
+	float outMin, float outMax, unsigned int discreteMask);
+
+/*
+This function builds the coarsest surface within maxError of pModel: starting
+from pResolution, every input's number of intervals is doubled until the
+error fits or an input would exceed maxResolution samples. Inputs in
+discreteMask keep their resolution.
+Returns 1 if the error fits, 0 otherwise (the finest surface tried is kept)
+*/
+int FuzzySurfaceBuildForError(FuzzySurface *pSurface, const FuzzyModel *pModel, const float *pMin, const float *pMax,
+	const int *pResolution, float outMin, float outMax, unsigned int discreteMask, int maxResolution, float maxError);
+
+/*
+This function returns the trilinear interpolation of the surface at pInputs.
+Inputs are clamped to the domain
+*/
+float FuzzySurfaceEvaluate(const FuzzySurface *pSurface, const float *pInputs);
+
+/*
+This function bounds the deviation between the surface and the clamped
+output of pModel, stores it in mMaxError and returns it. Along every input
+not in mDiscreteMask the deviation is checked on the samples, on every
+breakpoint of the model (feet and peaks of its membership functions) and on
+FUZZY_SURFACE_CHECK_NUM points between 2 of them, then widened by half its
+change towards the neighbor points, as FuzzyOctreeBuild does.
+mMaxError is FLT_MAX if the check points cannot be allocated
+*/
+float FuzzySurfaceMeasureError(FuzzySurface *pSurface, const FuzzyModel *pModel);
+
+/*
+This function returns the output of pModel clamped to the range of the surface
+*/
+float FuzzySurfaceEvaluateExact(const FuzzySurface *pSurface, const FuzzyModel *pModel, const float *pInputs);
+
+/*
+This function frees the samples of the surface
+*/
+void FuzzySurfaceFree(FuzzySurface *pSurface);
+
+#endif
@@ -0,0 +1,116 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyTrain.h
+Purpose:		Header file for FuzzyTrain.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_TRAIN_H
+#define FUZZY_TRAIN_H
+
+#include "Fuzzy.h"
+
+#define FUZZY_DATASET_MAGIC			"FZYD"				// First 4 bytes of a dataset file
+#define FUZZY_DATASET_VERSION		1
+#define FUZZY_CONSEQUENT_MAGIC		"FZYC"				// First 4 bytes of a trained consequents file
+#define FUZZY_CONSEQUENT_VERSION	1
+#define FUZZY_TRAIN_CHUNK_NUM		4096				// Samples read from a dataset at once
+#define FUZZY_TRAIN_RIDGE			1.0e-6f				// Default pull of the trained consequents towards the compiled ones
+#define FUZZY_TRAIN_PARAM_NUM_MAX	(FUZZY_RULE_NUM_MAX * (FUZZY_INPUT_NUM_MAX + 1))	// Consequent parameters of one output
+
+/*
+Dataset file (.fzd), little endian:
+	"FZYD", version (u32), input count (u32), 0 (u32)
+	then every sample: the inputs (f32), then the desired output (f32)
+Samples are only appended, a file cut short (game closed while recording)
+is read up to its last whole sample.
+
+Trained consequents file (.fzc), little endian:
+	"FZYC", version (u32), FuzzyModelHash of the compiled model (u32),
+	output count (u32), rule count (u32), input count (u32)
+	then for every output and every rule: the coefficient of every input, then the constant (f32)
+*/
+
+/*
+Dataset being recorded
+*/
+typedef struct FuzzyDataset
+{
+	void					*mpFile;
+	int						mInputNum;
+	unsigned int			mSampleNum;							// Samples written since FuzzyDatasetOpen
+}FuzzyDataset;
+
+/*
+Result of FuzzyModelTrain
+*/
+typedef struct FuzzyTrainStats
+{
+	unsigned int			mSampleNum;							// Samples used
+	unsigned int			mSkipNum;							// Samples where no rule fires
+	float					mErrorBefore;						// RMS error of the model before training
+	float					mErrorAfter;						// RMS error after training
+}FuzzyTrainStats;
+
+// ---------------------------------------------------------------------------
+
+/*
+This function opens the dataset pFileName for recording samples of
+inputNum inputs. Samples are appended to an existing dataset with the same
+number of inputs, otherwise the file is created. Returns 1 on success, 0 on failure
+*/
+int FuzzyDatasetOpen(FuzzyDataset *pDataset, const char *pFileName, int inputNum);
+
+/*
+This function appends the sample (pInputs, target) to the dataset
+*/
+void FuzzyDatasetAdd(FuzzyDataset *pDataset, const float *pInputs, float target);
+
+/*
+This function closes the dataset, if it is open
+*/
+void FuzzyDatasetClose(FuzzyDataset *pDataset);
+
+/*
+This function fits the linear consequents of the output "output" of pModel
+to the dataset pFileName by least squares (ANFIS forward pass): the model
+output is linear in the consequents once the normalized firing strengths
+are known, so the normal equations are accumulated one chunk of samples at
+a time and solved once (Cholesky). Every parameter is pulled towards its
+compiled value by ridge times its diagonal entry, which keeps the rules the
+dataset never fires unchanged. The file is read twice, the second time to
+measure the new error. The antecedents are not changed.
+Returns 1 on success, 0 on failure (FuzzyTrainGetError), in which case
+pModel is not changed
+*/
+int FuzzyModelTrain(FuzzyModel *pModel, int output, const char *pFileName, float ridge, FuzzyTrainStats *pStats);
+
+/*
+This function writes the consequents of pModel to pFileName, tagged with
+sourceHash, the FuzzyModelHash of the model before training.
+Returns 1 on success, 0 on failure
+*/
+int FuzzyConsequentsSave(const FuzzyModel *pModel, unsigned int sourceHash, const char *pFileName);
+
+/*
+This function replaces the consequents of pModel by the ones of
+pFileName, if they were trained from this model (FuzzyModelHash).
+Returns 1 on success, 0 if the file is missing, invalid or from another model
+*/
+int FuzzyConsequentsLoad(FuzzyModel *pModel, const char *pFileName);
+
+/*
+This function returns a description of the last failure
+*/
+const char *FuzzyTrainGetError(void);
+
+#endif
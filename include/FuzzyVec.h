@@ -0,0 +1,77 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyVec.h
+Purpose:		Vector type of the fuzzy kernels, picked from the instruction set of the build
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef FUZZY_VEC_H
+#define FUZZY_VEC_H
+
+/*
+FuzzyVec holds FUZZY_VEC_LANES floats. FUZZY_VEC_LANES is 1 when the build
+has no vector instruction set, the FuzzyVec operations are then undefined
+and callers only use their scalar path
+*/
+
+#if defined(__AVX__)
+
+#include <immintrin.h>
+
+#define FUZZY_VEC_NAME				"AVX"
+#define FUZZY_VEC_LANES				8
+
+typedef __m256 FuzzyVec;
+
+#define FuzzyVecSet1(a)				_mm256_set1_ps(a)
+#define FuzzyVecLoad(p)				_mm256_loadu_ps(p)
+#define FuzzyVecStore(p, a)			_mm256_storeu_ps(p, a)
+#define FuzzyVecAdd(a, b)			_mm256_add_ps(a, b)
+#define FuzzyVecSub(a, b)			_mm256_sub_ps(a, b)
+#define FuzzyVecMul(a, b)			_mm256_mul_ps(a, b)
+#define FuzzyVecDiv(a, b)			_mm256_div_ps(a, b)
+#define FuzzyVecSqrt(a)				_mm256_sqrt_ps(a)
+#define FuzzyVecMin(a, b)			_mm256_min_ps(a, b)
+#define FuzzyVecMax(a, b)			_mm256_max_ps(a, b)
+#define FuzzyVecAnd(a, b)			_mm256_and_ps(a, b)
+#define FuzzyVecGreater(a, b)		_mm256_cmp_ps(a, b, _CMP_GT_OQ)
+
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#include <emmintrin.h>
+
+#define FUZZY_VEC_NAME				"SSE2"
+#define FUZZY_VEC_LANES				4
+
+typedef __m128 FuzzyVec;
+
+#define FuzzyVecSet1(a)				_mm_set1_ps(a)
+#define FuzzyVecLoad(p)				_mm_loadu_ps(p)
+#define FuzzyVecStore(p, a)			_mm_storeu_ps(p, a)
+#define FuzzyVecAdd(a, b)			_mm_add_ps(a, b)
+#define FuzzyVecSub(a, b)			_mm_sub_ps(a, b)
+#define FuzzyVecMul(a, b)			_mm_mul_ps(a, b)
+#define FuzzyVecDiv(a, b)			_mm_div_ps(a, b)
+#define FuzzyVecSqrt(a)				_mm_sqrt_ps(a)
+#define FuzzyVecMin(a, b)			_mm_min_ps(a, b)
+#define FuzzyVecMax(a, b)			_mm_max_ps(a, b)
+#define FuzzyVecAnd(a, b)			_mm_and_ps(a, b)
+#define FuzzyVecGreater(a, b)		_mm_cmpgt_ps(a, b)
+
+#else
+
+#define FUZZY_VEC_NAME				"scalar"
+#define FUZZY_VEC_LANES				1
+
+#endif
+
+#endif
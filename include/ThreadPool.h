@@ -0,0 +1,83 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		ThreadPool.h
+Purpose:		Header file for ThreadPool.c
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#define THREAD_POOL_THREAD_NUM_MAX	64					// Maximum number of threads of a pool, the calling thread included
+
+/*
+Task run by the pool: index is the task index in [0, count), thread the
+index of the thread running it in [0, mThreadNum), 0 being the thread
+that called ThreadPoolRun. Per thread data can be indexed by thread
+*/
+typedef void (*ThreadPoolTask)(void *pContext, int index, int thread);
+
+typedef struct ThreadPool ThreadPool;
+
+/*
+Worker thread of a pool
+*/
+typedef struct ThreadPoolWorker
+{
+	ThreadPool				*mpPool;
+	int						mIndex;
+	void					*mpThread;
+}ThreadPoolWorker;
+
+/*
+Fixed set of worker threads running the tasks of ThreadPoolRun. Tasks are
+handed out one index at a time from a shared counter, so uneven tasks still
+keep every thread busy until the last ones. Threads sleep between runs.
+The pool must not be moved once initialized. Without Win32, the tasks run
+on the calling thread.
+*/
+struct ThreadPool
+{
+	int						mThreadNum;							// Worker threads + the calling thread
+	ThreadPoolWorker		mWorkers[THREAD_POOL_THREAD_NUM_MAX];	// Worker k runs as thread k (0 unused)
+
+	void					*mpStart;							// Semaphore: one count per worker and per run
+	void					*mpDone;							// Event set when the last worker leaves a run
+	volatile long			mNext;								// Next task index of the current run
+	volatile long			mBusy;								// Worker counts of the current run not returned yet
+	volatile long			mQuit;
+
+	ThreadPoolTask			mpTask;								// Current run
+	void					*mpContext;
+	long					mCount;
+};
+
+/*
+This function starts threadNum - 1 worker threads (threadNum = 0: one
+thread per processor). Returns 1 on success, 0 if the threads cannot be
+created, in which case the pool runs tasks on the calling thread only
+*/
+int ThreadPoolInit(ThreadPool *pPool, int threadNum);
+
+/*
+This function runs task(pContext, index, thread) for every index in
+[0, count) on all the threads of the pool, the calling thread included,
+and returns when all of them are done
+*/
+void ThreadPoolRun(ThreadPool *pPool, ThreadPoolTask task, void *pContext, int count);
+
+/*
+This function stops the worker threads
+*/
+void ThreadPoolFree(ThreadPool *pPool);
+
+#endif
@@ -0,0 +1,242 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotInfluence.c
+Purpose:		Tiled influence map of danger and opportunity, decayed and spread incrementally
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotInfluence.h"
+#include "FuzzyVec.h"
+#include <math.h>
+#include <string.h>
+
+#define BOT_INFLUENCE_EPSILON		1.0e-4f				// Influences decayed below are 0, before they become denormals
+
+// ---------------------------------------------------------------------------
+
+// Cell of coordinate "value" along an axis starting at "min" with cellNum cells, the border ones past the bounds
+static __inline int BotInfluenceCell(float value, float min, float cellSize, int cellNum)
+{
+	int cell = (int)floorf((value - min) / cellSize);
+
+	return cell < 0 ? 0 : cell >= cellNum ? cellNum - 1 : cell;
+}
+
+// ---------------------------------------------------------------------------
+
+static __inline float BotInfluenceMax(float a, float b)
+{
+	return a > b ? a : b;
+}
+
+// ---------------------------------------------------------------------------
+
+// Index of cell (cx, cy) in a layer
+static __inline int BotInfluenceIndex(const BotInfluence *pInfluence, int cx, int cy)
+{
+	unsigned int x = (unsigned int)cx, y = (unsigned int)cy;
+	unsigned int tile = (y / BOT_INFLUENCE_TILE) * pInfluence->mTileNumX + x / BOT_INFLUENCE_TILE;
+
+	return (int)(tile * BOT_INFLUENCE_TILE_CELL_NUM + (y % BOT_INFLUENCE_TILE) * BOT_INFLUENCE_TILE + x % BOT_INFLUENCE_TILE);
+}
+
+// ---------------------------------------------------------------------------
+
+void BotInfluenceInit(BotInfluence *pInfluence, float minX, float minY, float maxX, float maxY, float cellSize, float decay, float spread)
+{
+	float tileSize;
+
+	memset(pInfluence, 0, sizeof(BotInfluence));
+
+	// Cells twice as large until the rectangle fits
+	for (;;)
+	{
+		tileSize = cellSize * BOT_INFLUENCE_TILE;
+		pInfluence->mTileNumX = (int)ceilf((maxX - minX) / tileSize);
+		pInfluence->mTileNumY = (int)ceilf((maxY - minY) / tileSize);
+		if (pInfluence->mTileNumX < 1)
+			pInfluence->mTileNumX = 1;
+		if (pInfluence->mTileNumY < 1)
+			pInfluence->mTileNumY = 1;
+		if (pInfluence->mTileNumX * pInfluence->mTileNumY <= BOT_INFLUENCE_TILE_NUM_MAX)
+			break;
+		cellSize *= 2.0f;
+	}
+
+	pInfluence->mMinX = minX;
+	pInfluence->mMinY = minY;
+	pInfluence->mCellSize = cellSize;
+	pInfluence->mDecay = decay;
+	pInfluence->mSpread = spread;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotInfluenceUpdate(BotInfluence *pInfluence)
+{
+	const int tileNumX = pInfluence->mTileNumX, tileNumY = pInfluence->mTileNumY;
+	const float decay = pInfluence->mDecay, spread = pInfluence->mSpread;
+	int layer, tx, ty, r, c;
+
+	for (layer = 0; layer < BOT_INFLUENCE_NUM; ++layer)
+	{
+		const float *pSrc = pInfluence->mCells[pInfluence->mCurrent][layer];
+		float *pDst = pInfluence->mCells[!pInfluence->mCurrent][layer];
+		const unsigned char *pSrcLive = pInfluence->mLive[pInfluence->mCurrent][layer];
+		unsigned char *pDstLive = pInfluence->mLive[!pInfluence->mCurrent][layer];
+
+		for (ty = 0; ty < tileNumY; ++ty)
+			for (tx = 0; tx < tileNumX; ++tx)
+			{
+				int tile = ty * tileNumX + tx;
+				const float *pTile = pSrc + tile * BOT_INFLUENCE_TILE_CELL_NUM;
+				float *pDstTile = pDst + tile * BOT_INFLUENCE_TILE_CELL_NUM;
+
+				// Nothing live in or next to the tile: it stays 0, cleared once if it was written 2 updates ago
+				if (!pSrcLive[tile] && !(tx > 0 && pSrcLive[tile - 1]) && !(tx < tileNumX - 1 && pSrcLive[tile + 1]) &&
+					!(ty > 0 && pSrcLive[tile - tileNumX]) && !(ty < tileNumY - 1 && pSrcLive[tile + tileNumX]))
+				{
+					if (pDstLive[tile])
+					{
+						memset(pDstTile, 0, sizeof(float) * BOT_INFLUENCE_TILE_CELL_NUM);
+						pDstLive[tile] = 0;
+					}
+					continue;
+				}
+
+				for (r = 0; r < BOT_INFLUENCE_TILE; ++r)
+				{
+					const float *pRow = pTile + r * BOT_INFLUENCE_TILE;
+					const float *pUp, *pDown;
+					float *pOut = pDstTile + r * BOT_INFLUENCE_TILE;
+					float halo[BOT_INFLUENCE_TILE + 2];							// The row with its left and right neighbors
+
+					// Neighbor rows, in the tiles above and below at the tile edges. At
+					// the map edges the row itself, which adds nothing to the max
+					if (r > 0)
+						pUp = pRow - BOT_INFLUENCE_TILE;
+					else
+						pUp = ty > 0 ? pRow - tileNumX * BOT_INFLUENCE_TILE_CELL_NUM + (BOT_INFLUENCE_TILE - 1) * BOT_INFLUENCE_TILE : pRow;
+					if (r < BOT_INFLUENCE_TILE - 1)
+						pDown = pRow + BOT_INFLUENCE_TILE;
+					else
+						pDown = ty < tileNumY - 1 ? pRow + tileNumX * BOT_INFLUENCE_TILE_CELL_NUM - (BOT_INFLUENCE_TILE - 1) * BOT_INFLUENCE_TILE : pRow;
+
+					memcpy(halo + 1, pRow, sizeof(float) * BOT_INFLUENCE_TILE);
+					halo[0] = tx > 0 ? pRow[-BOT_INFLUENCE_TILE_CELL_NUM + BOT_INFLUENCE_TILE - 1] : pRow[0];
+					halo[BOT_INFLUENCE_TILE + 1] = tx < tileNumX - 1 ? pRow[BOT_INFLUENCE_TILE_CELL_NUM] : pRow[BOT_INFLUENCE_TILE - 1];
+
+					c = 0;
+#if FUZZY_VEC_LANES > 1
+					{
+						FuzzyVec vDecay = FuzzyVecSet1(decay), vSpread = FuzzyVecSet1(spread), vEpsilon = FuzzyVecSet1(BOT_INFLUENCE_EPSILON);
+
+						for (; c + FUZZY_VEC_LANES <= BOT_INFLUENCE_TILE; c += FUZZY_VEC_LANES)
+						{
+							FuzzyVec neighbor = FuzzyVecMax(FuzzyVecMax(FuzzyVecLoad(pUp + c), FuzzyVecLoad(pDown + c)),
+								FuzzyVecMax(FuzzyVecLoad(halo + c), FuzzyVecLoad(halo + c + 2)));
+
+							FuzzyVec cell = FuzzyVecMul(vDecay, FuzzyVecMax(FuzzyVecLoad(pRow + c), FuzzyVecMul(vSpread, neighbor)));
+
+							FuzzyVecStore(pOut + c, FuzzyVecAnd(cell, FuzzyVecGreater(cell, vEpsilon)));
+						}
+					}
+#endif
+					for (; c < BOT_INFLUENCE_TILE; ++c)
+					{
+						float neighbor = BotInfluenceMax(BotInfluenceMax(pUp[c], pDown[c]), BotInfluenceMax(halo[c], halo[c + 2]));
+						float cell = decay * BotInfluenceMax(pRow[c], spread * neighbor);
+
+						pOut[c] = cell > BOT_INFLUENCE_EPSILON ? cell : 0.0f;
+					}
+				}
+
+				pDstLive[tile] = 0;
+				for (c = 0; c < BOT_INFLUENCE_TILE_CELL_NUM && !pDstLive[tile]; ++c)
+					pDstLive[tile] = pDstTile[c] != 0.0f;
+			}
+	}
+
+	pInfluence->mCurrent = !pInfluence->mCurrent;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotInfluenceStamp(BotInfluence *pInfluence, int layer, float x0, float y0, float x1, float y1, float radius, float value)
+{
+	const float cellSize = pInfluence->mCellSize;
+	const int cellNumX = pInfluence->mTileNumX * BOT_INFLUENCE_TILE, cellNumY = pInfluence->mTileNumY * BOT_INFLUENCE_TILE;
+	float *pCells = pInfluence->mCells[pInfluence->mCurrent][layer];
+	unsigned char *pLive = pInfluence->mLive[pInfluence->mCurrent][layer];
+	float dx = x1 - x0, dy = y1 - y0, length2 = dx * dx + dy * dy;
+	float reach = radius + 0.5f * cellSize, reach2 = reach * reach;
+	int cx0, cx1, cy0, cy1, cx, cy;
+
+	cx0 = BotInfluenceCell((x0 < x1 ? x0 : x1) - reach, pInfluence->mMinX, cellSize, cellNumX);
+	cx1 = BotInfluenceCell((x0 < x1 ? x1 : x0) + reach, pInfluence->mMinX, cellSize, cellNumX);
+	cy0 = BotInfluenceCell((y0 < y1 ? y0 : y1) - reach, pInfluence->mMinY, cellSize, cellNumY);
+	cy1 = BotInfluenceCell((y0 < y1 ? y1 : y0) + reach, pInfluence->mMinY, cellSize, cellNumY);
+
+	for (cy = cy0; cy <= cy1; ++cy)
+		for (cx = cx0; cx <= cx1; ++cx)
+		{
+			// Distance from the cell center to the closest point of the segment
+			float px = pInfluence->mMinX + (cx + 0.5f) * cellSize - x0;
+			float py = pInfluence->mMinY + (cy + 0.5f) * cellSize - y0;
+			float t = length2 > 0.0f ? (px * dx + py * dy) / length2 : 0.0f;
+			int index;
+
+			t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+			px -= t * dx;
+			py -= t * dy;
+			if (px * px + py * py > reach2)
+				continue;
+
+			index = BotInfluenceIndex(pInfluence, cx, cy);
+			if (pCells[index] < value)
+			{
+				pCells[index] = value;
+				pLive[index / BOT_INFLUENCE_TILE_CELL_NUM] = 1;
+			}
+		}
+}
+
+// ---------------------------------------------------------------------------
+
+float BotInfluenceSample(const BotInfluence *pInfluence, int layer, float x, float y)
+{
+	int cx = BotInfluenceCell(x, pInfluence->mMinX, pInfluence->mCellSize, pInfluence->mTileNumX * BOT_INFLUENCE_TILE);
+	int cy = BotInfluenceCell(y, pInfluence->mMinY, pInfluence->mCellSize, pInfluence->mTileNumY * BOT_INFLUENCE_TILE);
+
+	return pInfluence->mCells[pInfluence->mCurrent][layer][BotInfluenceIndex(pInfluence, cx, cy)];
+}
+
+// ---------------------------------------------------------------------------
+
+void BotInfluenceSampleBatch(const BotInfluence *pInfluence, int layer, const float *pX, const float *pY, int pointNum, float *pOut)
+{
+	const float *pCells = pInfluence->mCells[pInfluence->mCurrent][layer];
+	const float minX = pInfluence->mMinX, minY = pInfluence->mMinY, invCellSize = 1.0f / pInfluence->mCellSize;
+	const int cellMaxX = pInfluence->mTileNumX * BOT_INFLUENCE_TILE - 1, cellMaxY = pInfluence->mTileNumY * BOT_INFLUENCE_TILE - 1;
+	int p;
+
+	for (p = 0; p < pointNum; ++p)
+	{
+		float fx = (pX[p] - minX) * invCellSize, fy = (pY[p] - minY) * invCellSize;
+
+		// Clamped before the conversion, as far points would not fit an int
+		fx = fx < 0.0f ? 0.0f : fx > (float)cellMaxX ? (float)cellMaxX : fx;
+		fy = fy < 0.0f ? 0.0f : fy > (float)cellMaxY ? (float)cellMaxY : fy;
+
+		pOut[p] = pCells[BotInfluenceIndex(pInfluence, (int)fx, (int)fy)];
+	}
+}
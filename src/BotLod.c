@@ -0,0 +1,90 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotLod.c
+Purpose:		Behavior levels of detail of the bots, with hysteresis between the levels
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotLod.h"
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+
+void BotLodDefaultSettings(BotLodSettings *pSettings)
+{
+	pSettings->mDistance[0] = 600.0f;
+	pSettings->mDistance[1] = 1200.0f;
+	pSettings->mHysteresis = 50.0f;
+	pSettings->mViewportMargin = 50.0f;
+	pSettings->mIntervalScale[BOT_LOD_NEAR] = 1.0f;
+	pSettings->mIntervalScale[BOT_LOD_MID] = 2.0f;
+	pSettings->mIntervalScale[BOT_LOD_FAR] = 4.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotLodInit(BotLod *pLod, const BotLodSettings *pSettings)
+{
+	memset(pLod, 0, sizeof(BotLod));
+	pLod->mSettings = *pSettings;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotLodBeginFrame(BotLod *pLod)
+{
+	memset(pLod->mFrameBotNum, 0, sizeof(pLod->mFrameBotNum));
+	memset(pLod->mFrameDecisionNum, 0, sizeof(pLod->mFrameDecisionNum));
+	++pLod->mFrameNum;
+}
+
+// ---------------------------------------------------------------------------
+
+int BotLodUpdate(BotLod *pLod, BotScheduler *pScheduler, int agent, float distance, float outside)
+{
+	const BotLodSettings *pSettings = &pLod->mSettings;
+	int level = pLod->mDistanceLevel[agent];
+
+	// One level at a time, each way only past the hysteresis band
+	while (level < BOT_LOD_NUM - 1 && distance > pSettings->mDistance[level] + pSettings->mHysteresis)
+		++level;
+	while (level > 0 && distance < pSettings->mDistance[level - 1] - pSettings->mHysteresis)
+		--level;
+	pLod->mDistanceLevel[agent] = (unsigned char)level;
+
+	if (pLod->mOffscreen[agent])
+		pLod->mOffscreen[agent] = outside > -pSettings->mViewportMargin;
+	else
+		pLod->mOffscreen[agent] = outside > pSettings->mViewportMargin;
+
+	if (pLod->mOffscreen[agent])
+		level = BOT_LOD_FAR;
+
+	if (level != pLod->mLevel[agent])
+	{
+		pLod->mLevel[agent] = (unsigned char)level;
+		BotSchedulerSetInterval(pScheduler, agent, pScheduler->mInterval * pSettings->mIntervalScale[level]);
+	}
+
+	++pLod->mFrameBotNum[level];
+	++pLod->mBotNum[level];
+
+	return level;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotLodCountDecision(BotLod *pLod, int agent)
+{
+	++pLod->mFrameDecisionNum[pLod->mLevel[agent]];
+	++pLod->mDecisionNum[pLod->mLevel[agent]];
+}
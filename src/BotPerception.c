@@ -0,0 +1,99 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotPerception.c
+Purpose:		Batched offset, distance, bearing and lateral offset of every bot-target pair
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotPerception.h"
+#include "FuzzyVec.h"
+#include <math.h>
+
+#define BOT_PERCEPTION_EPSILON		1.0e-20f			// Smallest |F| |D| divided by, the bearing is 0 below
+
+// ---------------------------------------------------------------------------
+
+void BotPerceptionUpdate(BotPerception *pPerception, const float *pBotX, const float *pBotY, const float *pForwardX, const float *pForwardY, int botNum,
+	const float *pTargetX, const float *pTargetY, int targetNum)
+{
+	int t, b;
+
+	if (botNum > BOT_PERCEPTION_BOT_NUM_MAX)
+		botNum = BOT_PERCEPTION_BOT_NUM_MAX;
+	if (targetNum > BOT_PERCEPTION_TARGET_NUM_MAX)
+		targetNum = BOT_PERCEPTION_TARGET_NUM_MAX;
+	pPerception->mBotNum = botNum;
+	pPerception->mTargetNum = targetNum;
+
+	for (t = 0; t < targetNum; ++t)
+	{
+		float *pOffsetX = pPerception->mOffsetX[t], *pOffsetY = pPerception->mOffsetY[t];
+		float *pDistance = pPerception->mDistance[t], *pLateral = pPerception->mLateral[t];
+		float *pCos = pPerception->mBearingCos[t], *pSin = pPerception->mBearingSin[t];
+
+		b = 0;
+#if FUZZY_VEC_LANES > 1
+		{
+			FuzzyVec targetX = FuzzyVecSet1(pTargetX[t]), targetY = FuzzyVecSet1(pTargetY[t]);
+			FuzzyVec epsilon = FuzzyVecSet1(BOT_PERCEPTION_EPSILON);
+
+			for (; b + FUZZY_VEC_LANES <= botNum; b += FUZZY_VEC_LANES)
+			{
+				FuzzyVec fx = FuzzyVecLoad(pForwardX + b), fy = FuzzyVecLoad(pForwardY + b);
+				FuzzyVec dx = FuzzyVecSub(targetX, FuzzyVecLoad(pBotX + b));
+				FuzzyVec dy = FuzzyVecSub(targetY, FuzzyVecLoad(pBotY + b));
+				FuzzyVec distance = FuzzyVecSqrt(FuzzyVecAdd(FuzzyVecMul(dx, dx), FuzzyVecMul(dy, dy)));
+				FuzzyVec forward = FuzzyVecSqrt(FuzzyVecAdd(FuzzyVecMul(fx, fx), FuzzyVecMul(fy, fy)));
+				FuzzyVec cross = FuzzyVecSub(FuzzyVecMul(fx, dy), FuzzyVecMul(fy, dx));
+				FuzzyVec dot = FuzzyVecAdd(FuzzyVecMul(fx, dx), FuzzyVecMul(fy, dy));
+				FuzzyVec product = FuzzyVecMul(distance, forward);
+
+				// 0 / epsilon is 0 when the target is on the bot
+				product = FuzzyVecMax(product, epsilon);
+
+				FuzzyVecStore(pOffsetX + b, dx);
+				FuzzyVecStore(pOffsetY + b, dy);
+				FuzzyVecStore(pDistance + b, distance);
+				FuzzyVecStore(pLateral + b, FuzzyVecDiv(cross, forward));
+				FuzzyVecStore(pCos + b, FuzzyVecDiv(dot, product));
+				FuzzyVecStore(pSin + b, FuzzyVecDiv(cross, product));
+			}
+		}
+#endif
+		for (; b < botNum; ++b)
+		{
+			float fx = pForwardX[b], fy = pForwardY[b];
+			float dx = pTargetX[t] - pBotX[b], dy = pTargetY[t] - pBotY[b];
+			float distance = sqrtf(dx * dx + dy * dy);
+			float forward = sqrtf(fx * fx + fy * fy);
+			float cross = fx * dy - fy * dx;
+			float product = distance * forward;
+
+			if (product < BOT_PERCEPTION_EPSILON)
+				product = BOT_PERCEPTION_EPSILON;
+
+			pOffsetX[b] = dx;
+			pOffsetY[b] = dy;
+			pDistance[b] = distance;
+			pLateral[b] = cross / forward;
+			pCos[b] = (fx * dx + fy * dy) / product;
+			pSin[b] = cross / product;
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+float BotPerceptionLateral(float forwardX, float forwardY, float offsetX, float offsetY)
+{
+	return (forwardX * offsetY - forwardY * offsetX) / sqrtf(forwardX * forwardX + forwardY * forwardY);
+}
@@ -0,0 +1,163 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotPlan.c
+Purpose:		Monte Carlo lookahead of the bot's height, rollouts run in parallel within a deadline
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotPlan.h"
+#include "BotScheduler.h"
+#include "FuzzyStats.h"
+#include <math.h>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+
+// Rollout index / mCandidateNum of candidate index % mCandidateNum, if the plan is not past its deadline
+static void BotPlanRollout(void *pContext, int index, int thread)
+{
+	BotPlan *pPlan = (BotPlan *)pContext;
+	const BotPlanSettings *pSettings = &pPlan->mSettings;
+	float targetY = pPlan->mCandidateY[index % pSettings->mCandidateNum];
+	BotSimWorld world;
+	int f;
+
+	// The rollouts evaluate the bot's model, each thread into its own counters
+	FuzzyStatsSetThread(thread);
+	if (BotSchedulerNow() - pPlan->mStart > pPlan->mDeadline)
+	{
+		pPlan->mDone[index] = 0;
+		return;
+	}
+
+	// Same snapshot, another player: xorshift seeded from the rollout
+	world = pPlan->mSnapshot;
+	world.mRandom ^= (unsigned int)(index / pSettings->mCandidateNum + 1) * 2654435761u;
+	if (world.mRandom == 0)
+		world.mRandom = 1;
+
+	for (f = 0; f < pSettings->mFrameNum && BotSimStepTo(&world, targetY); ++f)
+	{
+	}
+
+	pPlan->mScore[index] = (float)((world.mBotHitNum - pPlan->mSnapshot.mBotHitNum) - (world.mShipHitNum - pPlan->mSnapshot.mShipHitNum));
+	pPlan->mDone[index] = 1;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotPlanDefaultSettings(BotPlanSettings *pSettings, float minY, float maxY)
+{
+	pSettings->mCandidateNum = 8;
+	pSettings->mRolloutNum = 16;
+	pSettings->mFrameNum = 90;
+	pSettings->mBlend = 0.5f;
+	pSettings->mMinY = minY;
+	pSettings->mMaxY = maxY;
+	pSettings->mThreadNum = 0;
+}
+
+// ---------------------------------------------------------------------------
+
+int BotPlanInit(BotPlan *pPlan, const BotPlanSettings *pSettings)
+{
+	int c;
+
+	memset(pPlan, 0, sizeof(BotPlan));
+	pPlan->mSettings = *pSettings;
+
+	if (pPlan->mSettings.mCandidateNum < 1)
+		pPlan->mSettings.mCandidateNum = 1;
+	else if (pPlan->mSettings.mCandidateNum > BOT_PLAN_CANDIDATE_NUM_MAX)
+		pPlan->mSettings.mCandidateNum = BOT_PLAN_CANDIDATE_NUM_MAX;
+	if (pPlan->mSettings.mRolloutNum < 1)
+		pPlan->mSettings.mRolloutNum = 1;
+	else if (pPlan->mSettings.mRolloutNum > BOT_PLAN_ROLLOUT_NUM_MAX)
+		pPlan->mSettings.mRolloutNum = BOT_PLAN_ROLLOUT_NUM_MAX;
+
+	for (c = 0; c < pPlan->mSettings.mCandidateNum; ++c)
+	{
+		float t = pPlan->mSettings.mCandidateNum > 1 ? (float)c / (pPlan->mSettings.mCandidateNum - 1) : 0.5f;
+
+		pPlan->mCandidateY[c] = pPlan->mSettings.mMinY + t * (pPlan->mSettings.mMaxY - pPlan->mSettings.mMinY);
+	}
+
+	return ThreadPoolInit(&pPlan->mPool, pPlan->mSettings.mThreadNum);
+}
+
+// ---------------------------------------------------------------------------
+
+float BotPlanRun(BotPlan *pPlan, const BotSimWorld *pWorld, float fuzzyY, double deadline)
+{
+	const BotPlanSettings *pSettings = &pPlan->mSettings;
+	int candidateNum = pSettings->mCandidateNum, taskNum = candidateNum * pSettings->mRolloutNum;
+	int c, r, best = -1, doneNum = 0;
+	float bestScore = 0.0f;
+
+	pPlan->mSnapshot = *pWorld;
+	pPlan->mStart = BotSchedulerNow();
+	pPlan->mDeadline = deadline;
+	ThreadPoolRun(&pPlan->mPool, BotPlanRollout, pPlan, taskNum);
+
+	for (c = 0; c < candidateNum; ++c)
+	{
+		float sum = 0.0f, score;
+		int num = 0;
+
+		for (r = 0; r < pSettings->mRolloutNum; ++r)
+		{
+			if (pPlan->mDone[r * candidateNum + c])
+			{
+				sum += pPlan->mScore[r * candidateNum + c];
+				++num;
+			}
+		}
+		if (num == 0)
+			continue;
+		doneNum += num;
+
+		score = sum / num;
+		if (best < 0 || score > bestScore ||
+			(score == bestScore && fabsf(pPlan->mCandidateY[c] - fuzzyY) < fabsf(pPlan->mCandidateY[best] - fuzzyY)))
+		{
+			best = c;
+			bestScore = score;
+		}
+	}
+
+	pPlan->mPlanTime = BotSchedulerNow() - pPlan->mStart;
+	pPlan->mPlanRolloutNum = doneNum;
+	pPlan->mPlanDroppedNum = taskNum - doneNum;
+	++pPlan->mPlanNum;
+	pPlan->mRolloutNum += doneNum;
+	pPlan->mDroppedNum += taskNum - doneNum;
+	if (pPlan->mPlanTime > pPlan->mTimeMax)
+		pPlan->mTimeMax = pPlan->mPlanTime;
+
+	if (best < 0)
+	{
+		pPlan->mBestY = fuzzyY;
+		pPlan->mBestScore = 0.0f;
+		return fuzzyY;
+	}
+
+	pPlan->mBestY = pPlan->mCandidateY[best];
+	pPlan->mBestScore = bestScore;
+	return fuzzyY + (pPlan->mBestY - fuzzyY) * pSettings->mBlend;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotPlanFree(BotPlan *pPlan)
+{
+	ThreadPoolFree(&pPlan->mPool);
+}
@@ -0,0 +1,169 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotScheduler.c
+Purpose:		Bot decisions at a fixed rate, staggered over frames and within a time budget
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotScheduler.h"
+#include <string.h>
+
+#define BOT_SCHEDULER_GOLDEN_RATIO	0.618034f			// Fractional part of the golden ratio, the stagger of bots added
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// ---------------------------------------------------------------------------
+
+double BotSchedulerNow(void)
+{
+#ifdef _WIN32
+	static double sFrequency = 0.0;
+	LARGE_INTEGER counter;
+
+	if (sFrequency == 0.0)
+	{
+		LARGE_INTEGER frequency;
+
+		QueryPerformanceFrequency(&frequency);
+		sFrequency = (double)frequency.QuadPart;
+	}
+
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart * 1.0e6 / sFrequency;
+#else
+	return (double)clock() * 1.0e6 / CLOCKS_PER_SEC;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+
+void BotSchedulerInit(BotScheduler *pScheduler, int agentNum, float rate, double budget)
+{
+	int a;
+
+	memset(pScheduler, 0, sizeof(BotScheduler));
+
+	if (agentNum > BOT_SCHEDULER_AGENT_NUM_MAX)
+		agentNum = BOT_SCHEDULER_AGENT_NUM_MAX;
+
+	pScheduler->mAgentNum = agentNum;
+	pScheduler->mInterval = 1.0f / rate;
+	pScheduler->mBudget = budget;
+
+	// Bot a is due after a / agentNum of an interval
+	for (a = 0; a < agentNum; ++a)
+	{
+		pScheduler->mAgentInterval[a] = pScheduler->mInterval;
+		pScheduler->mAge[a] = pScheduler->mInterval * (float)(agentNum - a) / (float)agentNum;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+int BotSchedulerAddAgent(BotScheduler *pScheduler)
+{
+	int a = pScheduler->mAgentNum;
+	float phase;
+
+	if (a >= BOT_SCHEDULER_AGENT_NUM_MAX)
+		return -1;
+
+	// Bot a is due after the fractional part of a * golden ratio of an interval
+	phase = (float)a * BOT_SCHEDULER_GOLDEN_RATIO;
+	phase -= (float)(int)phase;
+
+	pScheduler->mAgentInterval[a] = pScheduler->mInterval;
+	pScheduler->mAge[a] = pScheduler->mInterval * (1.0f - phase);
+
+	return pScheduler->mAgentNum++;
+}
+
+// ---------------------------------------------------------------------------
+
+int BotSchedulerUpdate(BotScheduler *pScheduler, float frameTime, BotSchedulerDecide pDecide, void *pContext)
+{
+	double start = BotSchedulerNow(), elapsed = 0.0;
+	int visited, a, decisionNum = 0, deferredNum = 0;
+
+	pScheduler->mFrameStart = start;
+
+	for (a = 0; a < pScheduler->mAgentNum; ++a)
+		pScheduler->mAge[a] += frameTime;
+
+	// Round robin from the first bot deferred last frame
+	for (visited = 0, a = pScheduler->mNext; visited < pScheduler->mAgentNum; ++visited, a = (a + 1) % pScheduler->mAgentNum)
+	{
+		float interval = pScheduler->mAgentInterval[a];
+
+		if (pScheduler->mAge[a] < interval)
+			continue;
+
+		if (decisionNum > 0 && elapsed >= pScheduler->mBudget)
+		{
+			if (deferredNum++ == 0)
+				pScheduler->mNext = a;
+			continue;
+		}
+
+		pDecide(pContext, a);
+		elapsed = BotSchedulerNow() - start;
+		++decisionNum;
+
+		// Keeps the bot's phase, unless it was deferred for a whole interval
+		pScheduler->mAge[a] -= interval;
+		if (pScheduler->mAge[a] >= interval)
+			pScheduler->mAge[a] = 0.0f;
+	}
+
+	if (deferredNum == 0 && pScheduler->mAgentNum > 0)
+		pScheduler->mNext = (pScheduler->mNext + 1) % pScheduler->mAgentNum;
+
+	pScheduler->mFrameDecisionNum = decisionNum;
+	pScheduler->mFrameDeferredNum = deferredNum;
+	pScheduler->mFrameTime = elapsed;
+	pScheduler->mDecisionNum += decisionNum;
+	pScheduler->mDeferredNum += deferredNum;
+	++pScheduler->mFrameNum;
+	if (elapsed > pScheduler->mTimeMax)
+		pScheduler->mTimeMax = elapsed;
+
+	return decisionNum;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotSchedulerSetInterval(BotScheduler *pScheduler, int agent, float interval)
+{
+	pScheduler->mAgentInterval[agent] = interval;
+}
+
+// ---------------------------------------------------------------------------
+
+float BotSchedulerBlend(const BotScheduler *pScheduler, int agent)
+{
+	float blend = pScheduler->mAge[agent] / pScheduler->mAgentInterval[agent];
+
+	return blend < 1.0f ? blend : 1.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+double BotSchedulerBudgetLeft(const BotScheduler *pScheduler)
+{
+	double left = pScheduler->mBudget - (BotSchedulerNow() - pScheduler->mFrameStart);
+
+	return left > 0.0 ? left : 0.0;
+}
@@ -0,0 +1,235 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotSim.c
+Purpose:		Headless bot against scripted player matches
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotSim.h"
+#include <string.h>
+#include <math.h>
+
+// ---------------------------------------------------------------------------
+
+// xorshift32, one generator per match so that matches run on any thread
+static float BotSimRandom(BotSimWorld *pWorld)
+{
+	unsigned int x = pWorld->mRandom;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	pWorld->mRandom = x;
+
+	return (x >> 8) * (1.0f / 16777216.0f);
+}
+
+// ---------------------------------------------------------------------------
+
+static float BotSimClamp(float x, float lo, float hi)
+{
+	return x < lo ? lo : x > hi ? hi : x;
+}
+
+// ---------------------------------------------------------------------------
+
+static void BotSimFire(BotSimWorld *pWorld, float x, float y, float velocityY)
+{
+	BotSimBullet *pBullet;
+
+	if (pWorld->mBulletNum == BOT_SIM_BULLET_NUM_MAX)
+	{
+		return;
+	}
+
+	pBullet = pWorld->mBullets + pWorld->mBulletNum++;
+	pBullet->mX = x;
+	pBullet->mY = y;
+	pBullet->mVelocityY = velocityY;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotSimInit(BotSimWorld *pWorld, unsigned int seed)
+{
+	memset(pWorld, 0, sizeof(BotSimWorld));
+
+	pWorld->mShipY = -150.0f;
+	pWorld->mBotY = 150.0f;
+	pWorld->mShipHP = 100.0f;
+	pWorld->mBotHP = 100.0f;
+	pWorld->mShipAmmo = BOT_SIM_AMMO_MAX;
+	pWorld->mBotAmmo = BOT_SIM_AMMO_MAX;
+	pWorld->mShipTargetY = pWorld->mShipY;
+
+	// xorshift must not start at 0
+	pWorld->mRandom = seed * 2654435761u + 1u;
+	if (pWorld->mRandom == 0)
+	{
+		pWorld->mRandom = 1;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+// One frame of the match, the bot moving toward the height given by pModel, or toward targetY if pModel is 0
+static int BotSimAdvance(BotSimWorld *pWorld, const FuzzyModel *pModel, float targetY)
+{
+	const float half = 0.5f * BOT_SIM_SHIP_SIZE;
+	float inputs[3], toMoveY, dodge = 0.0f;
+	int b, n;
+
+	pWorld->mShipTimer += BOT_SIM_FRAME_TIME;
+	pWorld->mBotTimer += BOT_SIM_FRAME_TIME;
+
+	// Player: sidestep the closest bot bullet coming at it, otherwise line up with the bot
+	for (b = 0; b < pWorld->mBulletNum; ++b)
+	{
+		const BotSimBullet *pBullet = pWorld->mBullets + b;
+
+		if (pBullet->mVelocityY < 0.0f && pBullet->mY > pWorld->mShipY && fabsf(pBullet->mX - pWorld->mShipX) < half + 5.0f)
+			dodge = pBullet->mX > pWorld->mShipX ? -1.0f : 1.0f;
+	}
+
+	if (dodge != 0.0f)
+	{
+		pWorld->mShipX += dodge * BOT_SIM_SHIP_STEP;
+	}
+	else
+	{
+		float toX = pWorld->mBotX + pWorld->mShipOffsetX - pWorld->mShipX;
+
+		pWorld->mShipX += BotSimClamp(toX, -BOT_SIM_SHIP_STEP, BOT_SIM_SHIP_STEP);
+	}
+
+	if (fabsf(pWorld->mShipTargetY - pWorld->mShipY) < BOT_SIM_SHIP_STEP)
+	{
+		pWorld->mShipTargetY = -BOT_SIM_SHIP_SIZE - BotSimRandom(pWorld) * (BOT_SIM_WIN_Y - 2.0f * BOT_SIM_SHIP_SIZE);
+		pWorld->mShipOffsetX = (BotSimRandom(pWorld) - 0.5f) * BOT_SIM_SHIP_SIZE;
+	}
+	pWorld->mShipY += BotSimClamp(pWorld->mShipTargetY - pWorld->mShipY, -BOT_SIM_SHIP_STEP, BOT_SIM_SHIP_STEP);
+
+	pWorld->mShipX = BotSimClamp(pWorld->mShipX, -BOT_SIM_WIN_X + BOT_SIM_SHIP_SIZE, BOT_SIM_WIN_X - BOT_SIM_SHIP_SIZE);
+	pWorld->mShipY = BotSimClamp(pWorld->mShipY, -BOT_SIM_WIN_Y + BOT_SIM_SHIP_SIZE, -BOT_SIM_SHIP_SIZE);
+
+	if (pWorld->mShipAmmo > 0 && pWorld->mShipTimer > BOT_SIM_FIRE_DELAY && fabsf(pWorld->mBotX - pWorld->mShipX) < half)
+	{
+		BotSimFire(pWorld, pWorld->mShipX, pWorld->mShipY, BOT_SIM_BULLET_SPEED);
+		pWorld->mShipTimer = 0.0f;
+		--pWorld->mShipAmmo;
+	}
+	if (pWorld->mShipAmmo == 0 && pWorld->mShipTimer > BOT_SIM_RELOAD_TIME)
+	{
+		pWorld->mShipAmmo = BOT_SIM_AMMO_MAX;
+	}
+
+	// Bot: fire when the player is in front of it
+	if (pWorld->mBotAmmo > 0 && pWorld->mBotTimer > BOT_SIM_FIRE_DELAY && fabsf(pWorld->mShipX - pWorld->mBotX) < half)
+	{
+		BotSimFire(pWorld, pWorld->mBotX, pWorld->mBotY, -BOT_SIM_BULLET_SPEED);
+		pWorld->mBotTimer = 0.0f;
+		--pWorld->mBotAmmo;
+	}
+	if (pWorld->mBotAmmo == 0 && pWorld->mBotTimer > BOT_SIM_RELOAD_TIME)
+	{
+		pWorld->mBotAmmo = BOT_SIM_AMMO_MAX;
+	}
+
+	// Bullets move, hit or leave the window
+	for (b = 0, n = 0; b < pWorld->mBulletNum; ++b)
+	{
+		BotSimBullet bullet = pWorld->mBullets[b];
+		int keep = 1;
+
+		bullet.mY += bullet.mVelocityY * BOT_SIM_FRAME_TIME;
+
+		if (bullet.mVelocityY > 0.0f && fabsf(bullet.mX - pWorld->mBotX) <= half && fabsf(bullet.mY - pWorld->mBotY) <= half)
+		{
+			pWorld->mBotHP -= BOT_SIM_DAMAGE;
+			++pWorld->mShipHitNum;
+			keep = 0;
+		}
+		else if (bullet.mVelocityY < 0.0f && fabsf(bullet.mX - pWorld->mShipX) <= half && fabsf(bullet.mY - pWorld->mShipY) <= half)
+		{
+			pWorld->mShipHP -= BOT_SIM_DAMAGE;
+			++pWorld->mBotHitNum;
+			keep = 0;
+		}
+		else if (bullet.mY < -BOT_SIM_WIN_Y || bullet.mY > BOT_SIM_WIN_Y)
+		{
+			keep = 0;
+		}
+
+		if (keep)
+			pWorld->mBullets[n++] = bullet;
+	}
+	pWorld->mBulletNum = n;
+
+	// Bot movement, as in GameStateAsteroidsUpdate. Facing down, the lateral
+	// offset of the player (FindPlayer) is its x offset
+	{
+		float toMoveX = pWorld->mShipX - pWorld->mBotX;
+
+		if (toMoveX > BOT_SIM_BOT_STEP)
+			pWorld->mBotX += BOT_SIM_BOT_STEP;
+		else if (toMoveX < -BOT_SIM_BOT_STEP)
+			pWorld->mBotX -= BOT_SIM_BOT_STEP;
+	}
+
+	if (pModel)
+	{
+		inputs[0] = pWorld->mBotHP;
+		inputs[1] = (float)pWorld->mBotAmmo;
+		inputs[2] = fabsf(pWorld->mShipY);
+		targetY = FuzzyModelEvaluateSparse(pModel, inputs);
+	}
+	toMoveY = BotSimClamp(targetY, BOT_SIM_SHIP_SIZE, BOT_SIM_WIN_Y - BOT_SIM_SHIP_SIZE);
+
+	if (toMoveY - pWorld->mBotY > 0.5f * BOT_SIM_BOT_STEP)
+		pWorld->mBotY += BOT_SIM_BOT_STEP;
+	else if (toMoveY - pWorld->mBotY < -0.5f * BOT_SIM_BOT_STEP)
+		pWorld->mBotY -= BOT_SIM_BOT_STEP;
+	else
+		pWorld->mBotY = toMoveY;
+
+	++pWorld->mFrame;
+
+	return pWorld->mShipHP >= 0.0f && pWorld->mBotHP >= 0.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+int BotSimStep(BotSimWorld *pWorld, const FuzzyModel *pModel)
+{
+	return BotSimAdvance(pWorld, pModel, 0.0f);
+}
+
+// ---------------------------------------------------------------------------
+
+int BotSimStepTo(BotSimWorld *pWorld, float targetY)
+{
+	return BotSimAdvance(pWorld, 0, targetY);
+}
+
+// ---------------------------------------------------------------------------
+
+float BotSimPlay(const FuzzyModel *pModel, unsigned int seed, int frameNum)
+{
+	BotSimWorld world;
+
+	BotSimInit(&world, seed);
+	while (world.mFrame < frameNum && BotSimStep(&world, pModel))
+	{
+	}
+
+	return (float)(world.mBotHitNum - world.mShipHitNum);
+}
@@ -0,0 +1,126 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotTable.c
+Purpose:		Structure of arrays state of the bots of a world, updated in loops over every bot
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotTable.h"
+#include <math.h>
+
+// ---------------------------------------------------------------------------
+
+void BotTableInit(BotTable *pTable, float minY, float maxY)
+{
+	pTable->mBotNum = 0;
+	pTable->mMinY = minY;
+	pTable->mMaxY = maxY;
+}
+
+// ---------------------------------------------------------------------------
+
+int BotTableAdd(BotTable *pTable, float x, float y, float angle)
+{
+	int b = pTable->mBotNum;
+
+	if (b >= BOT_TABLE_BOT_NUM_MAX)
+		return -1;
+
+	pTable->mX[b] = x;
+	pTable->mY[b] = y;
+	pTable->mForwardX[b] = cosf(angle);
+	pTable->mForwardY[b] = sinf(angle);
+	pTable->mHP[b] = BOT_TABLE_HP_MAX;
+	pTable->mAmmo[b] = BOT_TABLE_AMMO_MAX;
+	pTable->mReloadTime[b] = 0.0f;
+	pTable->mTargetX[b] = x;
+	pTable->mFromY[b] = y;
+	pTable->mTargetY[b] = y;
+
+	return pTable->mBotNum++;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotTableReload(BotTable *pTable, float frameTime)
+{
+	float *pTime = pTable->mReloadTime;
+	int *pAmmo = pTable->mAmmo;
+	int b;
+
+	for (b = 0; b < pTable->mBotNum; ++b)
+	{
+		pTime[b] += frameTime;
+		if (pAmmo[b] == 0 && pTime[b] > BOT_TABLE_RELOAD_TIME)
+			pAmmo[b] = BOT_TABLE_AMMO_MAX;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+int BotTableFire(BotTable *pTable, int bot)
+{
+	if (pTable->mAmmo[bot] == 0)
+		return 0;
+
+	if (--pTable->mAmmo[bot] == 0)
+		pTable->mReloadTime[bot] = 0.0f;
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int BotTableHit(BotTable *pTable, int bot)
+{
+	pTable->mHP[bot] -= BOT_TABLE_DAMAGE;
+	if (pTable->mHP[bot] >= 0.0f)
+		return 0;
+
+	pTable->mHP[bot] = BOT_TABLE_HP_MAX;
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotTableMove(BotTable *pTable, const BotScheduler *pScheduler)
+{
+	float *pX = pTable->mX, *pY = pTable->mY;
+	const float *pTargetX = pTable->mTargetX, *pFromY = pTable->mFromY, *pTargetY = pTable->mTargetY;
+	float minY = pTable->mMinY, maxY = pTable->mMaxY;
+	int b;
+
+	for (b = 0; b < pTable->mBotNum; ++b)
+	{
+		float moveX = pTargetX[b] - pX[b];
+		float blend = pScheduler->mAge[b] / pScheduler->mAgentInterval[b];
+		float targetY, moveY;
+
+		if (moveX > BOT_TABLE_STEP)
+			pX[b] += BOT_TABLE_STEP;
+		else if (moveX < -BOT_TABLE_STEP)
+			pX[b] -= BOT_TABLE_STEP;
+
+		// BotSchedulerBlend, inlined
+		blend = blend < 1.0f ? blend : 1.0f;
+		targetY = pFromY[b] + (pTargetY[b] - pFromY[b]) * blend;
+		targetY = targetY < minY ? minY : targetY > maxY ? maxY : targetY;
+
+		moveY = targetY - pY[b];
+		if (moveY > 0.5f * BOT_TABLE_STEP)
+			pY[b] += BOT_TABLE_STEP;
+		else if (moveY < -0.5f * BOT_TABLE_STEP)
+			pY[b] -= BOT_TABLE_STEP;
+		else
+			pY[b] = targetY;
+	}
+}
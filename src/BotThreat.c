@@ -0,0 +1,186 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotThreat.c
+Purpose:		Grid of swept bullet paths, answering which bullets come at a bot and when
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotThreat.h"
+#include <math.h>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+
+// Cell of coordinate "value" along an axis starting at "min" with cellNum cells, the border ones past the bounds
+static __inline int BotThreatCell(float value, float min, float cellSize, int cellNum)
+{
+	int cell = (int)floorf((value - min) / cellSize);
+
+	return cell < 0 ? 0 : cell >= cellNum ? cellNum - 1 : cell;
+}
+
+// ---------------------------------------------------------------------------
+
+// Cells overlapped by the path of bullet b widened by mRadius: [pCell[0], pCell[1]] x [pCell[2], pCell[3]]
+static void BotThreatBulletCells(const BotThreatGrid *pGrid, int b, int *pCell)
+{
+	float x0 = pGrid->mX[b], x1 = x0 + pGrid->mVelocityX[b] * pGrid->mHorizon;
+	float y0 = pGrid->mY[b], y1 = y0 + pGrid->mVelocityY[b] * pGrid->mHorizon;
+	float radius = pGrid->mRadius;
+
+	pCell[0] = BotThreatCell((x0 < x1 ? x0 : x1) - radius, pGrid->mMinX, pGrid->mCellSize, pGrid->mCellNumX);
+	pCell[1] = BotThreatCell((x0 < x1 ? x1 : x0) + radius, pGrid->mMinX, pGrid->mCellSize, pGrid->mCellNumX);
+	pCell[2] = BotThreatCell((y0 < y1 ? y0 : y1) - radius, pGrid->mMinY, pGrid->mCellSize, pGrid->mCellNumY);
+	pCell[3] = BotThreatCell((y0 < y1 ? y1 : y0) + radius, pGrid->mMinY, pGrid->mCellSize, pGrid->mCellNumY);
+}
+
+// ---------------------------------------------------------------------------
+
+void BotThreatGridInit(BotThreatGrid *pGrid, float cellSize, float radius, float horizon)
+{
+	memset(pGrid, 0, sizeof(BotThreatGrid));
+	pGrid->mCellSizeMin = cellSize;
+	pGrid->mRadius = radius;
+	pGrid->mHorizon = horizon;
+}
+
+// ---------------------------------------------------------------------------
+
+int BotThreatGridBuild(BotThreatGrid *pGrid, float minX, float minY, float maxX, float maxY,
+	const float *pX, const float *pY, const float *pVelocityX, const float *pVelocityY, int bulletNum)
+{
+	float cellSize = pGrid->mCellSizeMin;
+	int *pStart = pGrid->mCellStart;
+	int cellNum, entryNum, b, cell[4], cx, cy, c;
+
+	// Cells twice as large until the rectangle fits
+	for (;;)
+	{
+		pGrid->mCellNumX = (int)ceilf((maxX - minX) / cellSize);
+		pGrid->mCellNumY = (int)ceilf((maxY - minY) / cellSize);
+		if (pGrid->mCellNumX < 1)
+			pGrid->mCellNumX = 1;
+		if (pGrid->mCellNumY < 1)
+			pGrid->mCellNumY = 1;
+		if (pGrid->mCellNumX * pGrid->mCellNumY <= BOT_THREAT_CELL_NUM_MAX)
+			break;
+		cellSize *= 2.0f;
+	}
+	cellNum = pGrid->mCellNumX * pGrid->mCellNumY;
+	pGrid->mCellSize = cellSize;
+	pGrid->mMinX = minX;
+	pGrid->mMinY = minY;
+
+	if (bulletNum > BOT_THREAT_BULLET_NUM_MAX)
+		bulletNum = BOT_THREAT_BULLET_NUM_MAX;
+
+	// Counting sort of the (cell, bullet) pairs by cell: first the number of
+	// bullets of every cell, while the bullets fit
+	memset(pStart, 0, sizeof(int) * (cellNum + 1));
+	entryNum = 0;
+	for (b = 0; b < bulletNum; ++b)
+	{
+		pGrid->mX[b] = pX[b];
+		pGrid->mY[b] = pY[b];
+		pGrid->mVelocityX[b] = pVelocityX[b];
+		pGrid->mVelocityY[b] = pVelocityY[b];
+
+		BotThreatBulletCells(pGrid, b, cell);
+		if (entryNum + (cell[1] - cell[0] + 1) * (cell[3] - cell[2] + 1) > BOT_THREAT_ENTRY_NUM_MAX)
+			break;
+		entryNum += (cell[1] - cell[0] + 1) * (cell[3] - cell[2] + 1);
+
+		for (cy = cell[2]; cy <= cell[3]; ++cy)
+			for (cx = cell[0]; cx <= cell[1]; ++cx)
+				++pStart[cy * pGrid->mCellNumX + cx];
+	}
+	pGrid->mDroppedNum = bulletNum - b;
+	pGrid->mBulletNum = bulletNum = b;
+
+	// Then the end of every cell, moved back to its start as it is filled
+	for (c = 1; c < cellNum; ++c)
+		pStart[c] += pStart[c - 1];
+	pStart[cellNum] = entryNum;
+
+	for (b = bulletNum - 1; b >= 0; --b)
+	{
+		BotThreatBulletCells(pGrid, b, cell);
+		for (cy = cell[2]; cy <= cell[3]; ++cy)
+			for (cx = cell[0]; cx <= cell[1]; ++cx)
+				pGrid->mEntries[--pStart[cy * pGrid->mCellNumX + cx]] = (unsigned short)b;
+	}
+
+	return bulletNum;
+}
+
+// ---------------------------------------------------------------------------
+
+void BotThreatQuery(const BotThreatGrid *pGrid, float x, float y, BotThreat *pThreat)
+{
+	float radius = pGrid->mRadius, radius2 = radius * radius;
+	int c, e;
+
+	pThreat->mBulletNum = 0;
+	pThreat->mTime = pGrid->mHorizon;
+	pThreat->mEscapeX = pThreat->mEscapeY = 0.0f;
+
+	if (pGrid->mCellNumX == 0)
+		return;
+
+	c = BotThreatCell(y, pGrid->mMinY, pGrid->mCellSize, pGrid->mCellNumY) * pGrid->mCellNumX +
+		BotThreatCell(x, pGrid->mMinX, pGrid->mCellSize, pGrid->mCellNumX);
+
+	for (e = pGrid->mCellStart[c]; e < pGrid->mCellStart[c + 1]; ++e)
+	{
+		int b = pGrid->mEntries[e];
+		float dx = x - pGrid->mX[b], dy = y - pGrid->mY[b];
+		float vx = pGrid->mVelocityX[b], vy = pGrid->mVelocityY[b];
+		float vv = vx * vx + vy * vy, dv = dx * vx + dy * vy, dd = dx * dx + dy * dy;
+		float t = 0.0f;
+
+		// Earliest root of |D - V t|^2 = radius^2, unless already within
+		if (dd > radius2)
+		{
+			float discriminant = dv * dv - vv * (dd - radius2);
+
+			if (dv <= 0.0f || discriminant < 0.0f)
+				continue;
+			t = (dv - sqrtf(discriminant)) / vv;
+			if (t > pGrid->mHorizon)
+				continue;
+		}
+
+		if (pThreat->mBulletNum++ > 0 && t >= pThreat->mTime)
+			continue;
+		pThreat->mTime = t;
+
+		if (vv > 0.0f)
+		{
+			// Along the normal N of the path, from the signed distance to radius on the same side
+			float speed = sqrtf(vv);
+			float nx = -vy / speed, ny = vx / speed;
+			float offset = dx * nx + dy * ny;
+			float move = (offset >= 0.0f ? radius : -radius) - offset;
+
+			pThreat->mEscapeX = move * nx;
+			pThreat->mEscapeY = move * ny;
+		}
+		else
+		{
+			// A bullet standing still, straight away from it
+			float distance = sqrtf(dd);
+
+			pThreat->mEscapeX = distance > 0.0f ? dx / distance * (radius - distance) : radius;
+			pThreat->mEscapeY = distance > 0.0f ? dy / distance * (radius - distance) : 0.0f;
+		}
+	}
+}
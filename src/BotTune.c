@@ -0,0 +1,362 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		BotTune.c
+Purpose:		Offline tuning of a bot's membership functions
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "BotTune.h"
+#include "BotSim.h"
+#include "FuzzyStats.h"
+#include "ThreadPool.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#define BOT_TUNE_SIGMA_MIN			0.002f				// Smallest mutation size, as a fraction of the domain
+#define BOT_TUNE_SIGMA_MAX			0.25f
+#define BOT_TUNE_WIDTH_MIN			0.05f				// Smallest support of a membership function, as a fraction of the domain
+
+/*
+Candidates of a generation, shared by the match tasks. Every task writes
+its own score, so the tasks do not synchronize
+*/
+typedef struct BotTuneRun
+{
+	const FuzzyModel		*mpModels;
+	const unsigned int		*mpSeeds;
+	float					*mpScores;							// Candidate c, match m: mpScores[c * mMatchNum + m]
+	int						mMatchNum;
+	int						mFrameNum;
+}BotTuneRun;
+
+// ---------------------------------------------------------------------------
+
+static void BotTuneMatch(void *pContext, int index, int thread)
+{
+	const BotTuneRun *pRun = (const BotTuneRun *)pContext;
+	int candidate = index / pRun->mMatchNum, match = index % pRun->mMatchNum;
+
+	FuzzyStatsSetThread(thread);
+	pRun->mpScores[index] = BotSimPlay(pRun->mpModels + candidate, pRun->mpSeeds[match], pRun->mFrameNum);
+}
+
+// ---------------------------------------------------------------------------
+
+// Mean score of every candidate, all their matches in one run of the pool
+static void BotTuneScore(ThreadPool *pPool, BotTuneRun *pRun, int candidateNum, float *pFitness)
+{
+	int c, m;
+
+	ThreadPoolRun(pPool, BotTuneMatch, pRun, candidateNum * pRun->mMatchNum);
+
+	for (c = 0; c < candidateNum; ++c)
+	{
+		float sum = 0.0f;
+
+		for (m = 0; m < pRun->mMatchNum; ++m)
+			sum += pRun->mpScores[c * pRun->mMatchNum + m];
+		pFitness[c] = sum / pRun->mMatchNum;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+static double BotTuneTime(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER counter, frequency;
+
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+
+// Plays the matches of the first candidate on the calling thread alone, then
+// on the whole pool, and logs both times and the speedup. The matches are
+// deterministic, so both runs must give the same scores
+static void BotTuneScaling(ThreadPool *pPool, BotTuneRun *pRun, FILE *pLog)
+{
+	float poolScore = 0.0f, singleScore = 0.0f;
+	double start, singleTime, poolTime;
+	int m;
+
+	start = BotTuneTime();
+	for (m = 0; m < pRun->mMatchNum; ++m)
+		BotTuneMatch(pRun, m, 0);
+	singleTime = BotTuneTime() - start;
+	for (m = 0; m < pRun->mMatchNum; ++m)
+		singleScore += pRun->mpScores[m];
+
+	start = BotTuneTime();
+	ThreadPoolRun(pPool, BotTuneMatch, pRun, pRun->mMatchNum);
+	poolTime = BotTuneTime() - start;
+	for (m = 0; m < pRun->mMatchNum; ++m)
+		poolScore += pRun->mpScores[m];
+
+	fprintf(pLog, "scaling: %d matches in %.3f s on 1 thread, %.3f s on %d threads, speedup %.2f%s\n", pRun->mMatchNum,
+		singleTime, poolTime, pPool->mThreadNum, poolTime > 0.0 ? singleTime / poolTime : 0.0,
+		poolScore == singleScore ? "" : ", SCORES DIFFER");
+}
+
+// ---------------------------------------------------------------------------
+
+static unsigned int BotTuneRandom(unsigned int *pState)
+{
+	unsigned int x = *pState;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*pState = x;
+
+	return x;
+}
+
+// Standard normal deviate (Box-Muller)
+static float BotTuneGaussian(unsigned int *pState)
+{
+	float u = ((BotTuneRandom(pState) >> 8) + 1) * (1.0f / 16777217.0f);
+	float v = (BotTuneRandom(pState) >> 8) * (1.0f / 16777216.0f);
+
+	return sqrtf(-2.0f * logf(u)) * cosf(6.2831853f * v);
+}
+
+// ---------------------------------------------------------------------------
+
+static float BotTuneClamp(float x, float lo, float hi)
+{
+	return x < lo ? lo : x > hi ? hi : x;
+}
+
+// ---------------------------------------------------------------------------
+
+// Moves the breakpoints of the num triangles pMfs inside [lo, hi] by
+// sigma * (hi - lo). Breakpoints on a bound stay there (shoulders), then
+// every triangle is put back in order with a support of at least BOT_TUNE_WIDTH_MIN
+static void BotTuneMutate(FuzzyTriangle *pMfs, int num, float lo, float hi, float sigma, unsigned int *pRandom)
+{
+	float scale = sigma * (hi - lo), widthMin = BOT_TUNE_WIDTH_MIN * (hi - lo);
+	int m, k;
+
+	for (m = 0; m < num; ++m)
+	{
+		float p[3], t;
+
+		p[0] = pMfs[m].a;
+		p[1] = pMfs[m].b;
+		p[2] = pMfs[m].c;
+
+		for (k = 0; k < 3; ++k)
+		{
+			if (p[k] > lo && p[k] < hi)
+				p[k] = BotTuneClamp(p[k] + scale * BotTuneGaussian(pRandom), lo, hi);
+		}
+
+		if (p[0] > p[1]) { t = p[0]; p[0] = p[1]; p[1] = t; }
+		if (p[1] > p[2]) { t = p[1]; p[1] = p[2]; p[2] = t; }
+		if (p[0] > p[1]) { t = p[0]; p[0] = p[1]; p[1] = t; }
+
+		if (p[2] - p[0] < widthMin)
+		{
+			p[2] = p[0] + widthMin;
+			if (p[2] > hi)
+			{
+				p[2] = hi;
+				p[0] = hi - widthMin;
+			}
+			p[1] = BotTuneClamp(p[1], p[0], p[2]);
+		}
+
+		pMfs[m].a = p[0];
+		pMfs[m].b = p[1];
+		pMfs[m].c = p[2];
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+// Domain of num triangles: from the lowest foot to the highest one
+static void BotTuneDomain(const FuzzyTriangle *pMfs, int num, float *pLo, float *pHi)
+{
+	int m;
+
+	*pLo = pMfs[0].a;
+	*pHi = pMfs[0].c;
+	for (m = 1; m < num; ++m)
+	{
+		*pLo = pMfs[m].a < *pLo ? pMfs[m].a : *pLo;
+		*pHi = pMfs[m].c > *pHi ? pMfs[m].c : *pHi;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+void BotTuneDefaultSettings(BotTuneSettings *pSettings)
+{
+	pSettings->mGenerationNum = 50;
+	pSettings->mParentNum = 4;
+	pSettings->mChildNum = 24;
+	pSettings->mMatchNum = 32;
+	pSettings->mFrameNum = 3600;
+	pSettings->mThreadNum = 0;
+	pSettings->mSigma = 0.05f;
+	pSettings->mSeed = 1;
+}
+
+// ---------------------------------------------------------------------------
+
+float BotTune(FuzzyRuleBase *pBest, const FuzzyRuleBase *pStart, const BotTuneSettings *pSettings, FILE *pLog)
+{
+	BotTuneSettings settings = *pSettings;
+	FuzzyRuleBase *pPopulation;							// Parents then children
+	FuzzyModel *pModels;
+	float *pFitness, *pScores;
+	unsigned int *pSeeds;
+	float inLo[FUZZY_INPUT_NUM_MAX], inHi[FUZZY_INPUT_NUM_MAX], outLo, outHi;
+	float sigma = settings.mSigma, best;
+	unsigned int random = settings.mSeed * 2654435761u + 1u;
+	int parentNum = 1, g, c, i, m;
+	ThreadPool pool;
+	BotTuneRun run;
+
+	settings.mParentNum = settings.mParentNum < 1 ? 1 : settings.mParentNum > BOT_TUNE_PARENT_NUM_MAX ? BOT_TUNE_PARENT_NUM_MAX : settings.mParentNum;
+	settings.mChildNum = settings.mChildNum < 1 ? 1 : settings.mChildNum > BOT_TUNE_CHILD_NUM_MAX ? BOT_TUNE_CHILD_NUM_MAX : settings.mChildNum;
+	settings.mMatchNum = settings.mMatchNum < 1 ? 1 : settings.mMatchNum;
+
+	pPopulation = (FuzzyRuleBase *)malloc((settings.mParentNum + settings.mChildNum) * sizeof(FuzzyRuleBase));
+	pModels = (FuzzyModel *)malloc((settings.mParentNum + settings.mChildNum) * sizeof(FuzzyModel));
+	pFitness = (float *)malloc((settings.mParentNum + settings.mChildNum) * sizeof(float));
+	pScores = (float *)malloc((settings.mParentNum + settings.mChildNum) * settings.mMatchNum * sizeof(float));
+	pSeeds = (unsigned int *)malloc(settings.mMatchNum * sizeof(unsigned int));
+
+	if (!pPopulation || !pModels || !pFitness || !pScores || !pSeeds)
+	{
+		free(pPopulation);
+		free(pModels);
+		free(pFitness);
+		free(pScores);
+		free(pSeeds);
+		*pBest = *pStart;
+		return 0.0f;
+	}
+
+	ThreadPoolInit(&pool, settings.mThreadNum);
+
+	for (i = 0; i < pStart->mInputNum; ++i)
+		BotTuneDomain(pStart->mInputMf[i], pStart->mMfNum[i], inLo + i, inHi + i);
+	BotTuneDomain(pStart->mOutputMf[0], pStart->mOutputMfNum[0], &outLo, &outHi);
+
+	// Every candidate plays the same matches, so scores differ by the rule base only
+	for (m = 0; m < settings.mMatchNum; ++m)
+		pSeeds[m] = BotTuneRandom(&random);
+
+	run.mpModels = pModels;
+	run.mpSeeds = pSeeds;
+	run.mpScores = pScores;
+	run.mMatchNum = settings.mMatchNum;
+	run.mFrameNum = settings.mFrameNum;
+
+	pPopulation[0] = *pStart;
+	FuzzyModelCompile(pModels, pPopulation);
+	BotTuneScore(&pool, &run, 1, pFitness);
+
+	if (pLog)
+	{
+		fprintf(pLog, "start: score %.3f, %d threads\n", pFitness[0], pool.mThreadNum);
+		BotTuneScaling(&pool, &run, pLog);
+	}
+
+	for (g = 0; g < settings.mGenerationNum; ++g)
+	{
+		FuzzyRuleBase *pChildren = pPopulation + parentNum;
+		double start = BotTuneTime();
+		float mean = 0.0f;
+		int successNum = 0;
+
+		// Children are mutated and compiled here, the pool only plays matches
+		for (c = 0; c < settings.mChildNum; ++c)
+		{
+			FuzzyRuleBase *pChild = pChildren + c;
+
+			*pChild = pPopulation[BotTuneRandom(&random) % parentNum];
+			for (i = 0; i < pChild->mInputNum; ++i)
+				BotTuneMutate(pChild->mInputMf[i], pChild->mMfNum[i], inLo[i], inHi[i], sigma, &random);
+			BotTuneMutate(pChild->mOutputMf[0], pChild->mOutputMfNum[0], outLo, outHi, sigma, &random);
+
+			FuzzyModelCompile(pModels + c, pChild);
+		}
+
+		BotTuneScore(&pool, &run, settings.mChildNum, pFitness + parentNum);
+
+		for (c = 0; c < settings.mChildNum; ++c)
+		{
+			mean += pFitness[parentNum + c];
+			successNum += pFitness[parentNum + c] > pFitness[0];
+		}
+		mean /= settings.mChildNum;
+
+		// Keep the best mParentNum of parents and children, by selection sort.
+		// Parents keep their scores: the matches do not change
+		for (i = 0; i < settings.mParentNum && i < parentNum + settings.mChildNum; ++i)
+		{
+			int top = i;
+
+			for (c = i + 1; c < parentNum + settings.mChildNum; ++c)
+				top = pFitness[c] > pFitness[top] ? c : top;
+
+			if (top != i)
+			{
+				FuzzyRuleBase ruleBase = pPopulation[i];
+				float fitness = pFitness[i];
+
+				pPopulation[i] = pPopulation[top];
+				pPopulation[top] = ruleBase;
+				pFitness[i] = pFitness[top];
+				pFitness[top] = fitness;
+			}
+		}
+		parentNum = i;
+
+		// 1/5th success rule
+		sigma *= (successNum * 5 > settings.mChildNum) ? 1.22f : 0.82f;
+		sigma = BotTuneClamp(sigma, BOT_TUNE_SIGMA_MIN, BOT_TUNE_SIGMA_MAX);
+
+		if (pLog)
+		{
+			fprintf(pLog, "generation %d: best %.3f, mean %.3f, sigma %.4f, %.2f s\n", g + 1, pFitness[0], mean, sigma, BotTuneTime() - start);
+			fflush(pLog);
+		}
+	}
+
+	*pBest = pPopulation[0];
+	best = pFitness[0];
+
+	ThreadPoolFree(&pool);
+	free(pPopulation);
+	free(pModels);
+	free(pFitness);
+	free(pScores);
+	free(pSeeds);
+
+	return best;
+}
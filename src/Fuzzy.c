@@ -0,0 +1,712 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		Fuzzy.c
+Purpose:		Compiled Takagi-Sugeno fuzzy model used by the bot
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "Fuzzy.h"
+#include "FuzzyMembership.h"
+#include "FuzzyStats.h"
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+
+static __inline float FuzzyMin(float a, float b)
+{
+	return a < b ? a : b;
+}
+
+static __inline float FuzzyMax(float a, float b)
+{
+	return a > b ? a : b;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyModelCompile(FuzzyModel *pModel, const FuzzyRuleBase *pRuleBase)
+{
+	int i, m, o, r;
+
+	memset(pModel, 0, sizeof(FuzzyModel));
+
+	pModel->mInputNum = pRuleBase->mInputNum;
+	pModel->mRuleNum = pRuleBase->mRuleNum;
+	pModel->mOutputNum = pRuleBase->mOutputNum;
+
+	// Membership functions: the ramps of FuzzyMfSet, see FuzzyMembership.h
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		FuzzyMfSet set;
+
+		FuzzyMfSetCompileTriangles(&set, pRuleBase->mInputMf[i], pRuleBase->mMfNum[i]);
+
+		pModel->mMfNum[i] = pRuleBase->mMfNum[i];
+		memcpy(pModel->mMfA[i], set.mA, sizeof(set.mA));
+		memcpy(pModel->mMfC[i], set.mD, sizeof(set.mD));
+		memcpy(pModel->mMfInvL[i], set.mInvL, sizeof(set.mInvL));
+		memcpy(pModel->mMfInvR[i], set.mInvR, sizeof(set.mInvR));
+		memcpy(pModel->mMfBiasL[i], set.mBiasL, sizeof(set.mBiasL));
+		memcpy(pModel->mMfBiasR[i], set.mBiasR, sizeof(set.mBiasR));
+	}
+
+	// Rules: convert the Mamdani output triangles to linear consequents
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+	{
+		for (i = 0; i < pRuleBase->mInputNum; ++i)
+			pModel->mRuleMf[i][r] = (unsigned char)pRuleBase->mRuleMf[r][i];
+
+		for (o = 0; o < pRuleBase->mOutputNum; ++o)
+		{
+			const FuzzyTriangle *pOut = &pRuleBase->mOutputMf[o][pRuleBase->mRuleOutput[r][o]];
+			float constant = pOut->b;
+
+			for (i = 0; i < pRuleBase->mInputNum; ++i)
+			{
+				const FuzzyTriangle *pMf = &pRuleBase->mInputMf[i][pRuleBase->mRuleMf[r][i]];
+				float coef = 0.0f;
+
+				if (pMf->c > pMf->a)
+				{
+					coef = (pOut->c - pOut->a) / (pMf->c - pMf->a);
+				}
+
+				pModel->mRuleCoef[o][i][r] = coef;
+				constant -= coef * pMf->b;
+			}
+
+			pModel->mRuleConst[o][r] = constant;
+			pModel->mRuleClass[o][r] = (unsigned char)pRuleBase->mRuleOutput[r][o];
+		}
+	}
+
+	// Output classes, for the Mamdani evaluation
+	for (o = 0; o < pRuleBase->mOutputNum; ++o)
+	{
+		pModel->mOutputMfNum[o] = pRuleBase->mOutputMfNum[o];
+		for (m = 0; m < pRuleBase->mOutputMfNum[o]; ++m)
+		{
+			pModel->mOutputA[o][m] = pRuleBase->mOutputMf[o][m].a;
+			pModel->mOutputB[o][m] = pRuleBase->mOutputMf[o][m].b;
+			pModel->mOutputC[o][m] = pRuleBase->mOutputMf[o][m].c;
+		}
+	}
+
+	// Segments: split each input's domain at the feet of its membership
+	// functions, and list the membership functions touching each segment
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		float *pBound = pModel->mSegBound[i];
+		int boundNum = 0, k, j;
+
+		for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+		{
+			float feet[2];
+
+			feet[0] = pRuleBase->mInputMf[i][m].a;
+			feet[1] = pRuleBase->mInputMf[i][m].c;
+
+			for (j = 0; j < 2; ++j)
+			{
+				// Sorted insertion, skipping duplicates
+				for (k = boundNum; k > 0 && pBound[k - 1] > feet[j]; --k)
+					;
+				if (k > 0 && pBound[k - 1] == feet[j])
+					continue;
+				memmove(pBound + k + 1, pBound + k, (boundNum - k) * sizeof(float));
+				pBound[k] = feet[j];
+				++boundNum;
+			}
+		}
+
+		// A single bound (all triangles are a point) still makes one segment
+		if (boundNum == 1)
+		{
+			pBound[boundNum++] = pBound[0];
+		}
+		pModel->mSegNum[i] = boundNum - 1;
+
+		// A membership function is listed if its support overlaps the segment,
+		// or if it is a right shoulder ending on the segment's lower bound
+		// (it is 1 there, and x == lower bound is looked up in this segment)
+		for (k = 0; k < pModel->mSegNum[i]; ++k)
+		{
+			for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+			{
+				const FuzzyTriangle *pMf = &pRuleBase->mInputMf[i][m];
+
+				if ((pMf->a < pBound[k + 1] && pMf->c > pBound[k]) ||
+					(pMf->b == pMf->c && pMf->c == pBound[k]) ||
+					(pMf->a == pMf->c && pMf->a == pBound[k + 1]))
+				{
+					pModel->mSegMf[i][k][pModel->mSegMfNum[i][k]++] = (unsigned char)m;
+				}
+			}
+		}
+	}
+
+	// Cells: bucket the rules by their position in the antecedent grid
+	{
+		unsigned short count[FUZZY_CELL_NUM_MAX + 1];
+		int cellNum = 1, cell;
+
+		for (i = 0; i < pRuleBase->mInputNum; ++i)
+		{
+			pModel->mCellStride[i] = cellNum;
+			cellNum *= pRuleBase->mMfNum[i];
+		}
+
+		memset(count, 0, sizeof(count));
+		for (r = 0; r < pRuleBase->mRuleNum; ++r)
+		{
+			for (cell = 0, i = 0; i < pRuleBase->mInputNum; ++i)
+				cell += pRuleBase->mRuleMf[r][i] * pModel->mCellStride[i];
+			++count[cell + 1];
+		}
+
+		for (cell = 0; cell < cellNum; ++cell)
+		{
+			pModel->mCellStart[cell + 1] = pModel->mCellStart[cell] + count[cell + 1];
+			count[cell + 1] = pModel->mCellStart[cell];
+		}
+
+		for (r = 0; r < pRuleBase->mRuleNum; ++r)
+		{
+			for (cell = 0, i = 0; i < pRuleBase->mInputNum; ++i)
+				cell += pRuleBase->mRuleMf[r][i] * pModel->mCellStride[i];
+			pModel->mCellRule[count[cell + 1]++] = (unsigned char)r;
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyModelEvaluate(const FuzzyModel *pModel, const float *pInputs)
+{
+	float mu[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	float numerator = 0.0f, denominator = 0.0f;
+	int i, m, r;
+
+	// Memberships of every input, computed once
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		float x = pInputs[i];
+
+		for (m = 0; m < pModel->mMfNum[i]; ++m)
+		{
+			float left = (x - pModel->mMfA[i][m]) * pModel->mMfInvL[i][m] + pModel->mMfBiasL[i][m];
+			float right = (pModel->mMfC[i][m] - x) * pModel->mMfInvR[i][m] + pModel->mMfBiasR[i][m];
+
+			mu[i][m] = FuzzyMax(0.0f, FuzzyMin(left, right));
+		}
+	}
+
+	// Firing strength (min) and consequent (dot product) of every rule
+	if (pModel->mInputNum == 3)
+	{
+		// Unrolled form of the loop below for the bot's 3 inputs
+		for (r = 0; r < pModel->mRuleNum; ++r)
+		{
+			float firing = FuzzyMin(mu[0][pModel->mRuleMf[0][r]], FuzzyMin(mu[1][pModel->mRuleMf[1][r]], mu[2][pModel->mRuleMf[2][r]]));
+			float w = pModel->mRuleConst[0][r] + pModel->mRuleCoef[0][0][r] * pInputs[0] + pModel->mRuleCoef[0][1][r] * pInputs[1] + pModel->mRuleCoef[0][2][r] * pInputs[2];
+
+			numerator += firing * w;
+			denominator += firing;
+		}
+	}
+	else for (r = 0; r < pModel->mRuleNum; ++r)
+	{
+		float firing = mu[0][pModel->mRuleMf[0][r]];
+		float w = pModel->mRuleConst[0][r] + pModel->mRuleCoef[0][0][r] * pInputs[0];
+
+		for (i = 1; i < pModel->mInputNum; ++i)
+		{
+			firing = FuzzyMin(firing, mu[i][pModel->mRuleMf[i][r]]);
+			w += pModel->mRuleCoef[0][i][r] * pInputs[i];
+		}
+
+		numerator += firing * w;
+		denominator += firing;
+	}
+
+	if (denominator <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return numerator / denominator;
+}
+
+// ---------------------------------------------------------------------------
+
+// Active membership functions of input i at x: the ones listed for the
+// segment containing x. Some of them can still be 0 at x, the rules they
+// lead to then just add nothing
+static __inline void FuzzyModelState(const FuzzyModel *pModel, int i, float x, FuzzyInputState *pState)
+{
+	const float *pBound = pModel->mSegBound[i];
+	int j, k;
+
+	// Outside of every support, nothing can fire
+	if (x < pBound[0] || x > pBound[pModel->mSegNum[i]])
+	{
+		pState->mpActive = pModel->mSegMf[i][0];
+		pState->mActiveNum = 0;
+		return;
+	}
+
+	// Segment index without a data dependent branch
+	for (k = 0, j = 1; j < pModel->mSegNum[i]; ++j)
+		k += (x >= pBound[j]);
+
+	pState->mpActive = pModel->mSegMf[i][k];
+	pState->mActiveNum = pModel->mSegMfNum[i][k];
+
+	for (j = 0; j < pState->mActiveNum; ++j)
+	{
+		int m = pState->mpActive[j];
+		float left = (x - pModel->mMfA[i][m]) * pModel->mMfInvL[i][m] + pModel->mMfBiasL[i][m];
+		float right = (pModel->mMfC[i][m] - x) * pModel->mMfInvR[i][m] + pModel->mMfBiasR[i][m];
+
+		pState->mMu[m] = FuzzyMax(0.0f, FuzzyMin(left, right));
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyModelCellRules(const FuzzyModel *pModel, const unsigned char *const *ppActive, const int *pActiveNum, unsigned char *pRules)
+{
+	int pos[FUZZY_INPUT_NUM_MAX];
+	int i, j, num = 0;
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		if (pActiveNum[i] == 0)
+		{
+			return 0;
+		}
+	}
+
+	if (pModel->mInputNum == 3)
+	{
+		// Unrolled form of the odometer below for the bot's 3 inputs
+		int h, a, p;
+
+		for (h = 0; h < pActiveNum[0]; ++h)
+		{
+			for (a = 0; a < pActiveNum[1]; ++a)
+			{
+				int cellHA = ppActive[0][h] * pModel->mCellStride[0] + ppActive[1][a] * pModel->mCellStride[1];
+
+				for (p = 0; p < pActiveNum[2]; ++p)
+				{
+					int cell = cellHA + ppActive[2][p] * pModel->mCellStride[2];
+
+					for (j = pModel->mCellStart[cell]; j < pModel->mCellStart[cell + 1]; ++j)
+						pRules[num++] = pModel->mCellRule[j];
+				}
+			}
+		}
+	}
+	else
+	{
+		// Visit every combination of active membership functions (odometer order)
+		for (i = 0; i < pModel->mInputNum; ++i)
+			pos[i] = 0;
+
+		for (;;)
+		{
+			int cell = 0;
+
+			for (i = 0; i < pModel->mInputNum; ++i)
+				cell += ppActive[i][pos[i]] * pModel->mCellStride[i];
+
+			for (j = pModel->mCellStart[cell]; j < pModel->mCellStart[cell + 1]; ++j)
+				pRules[num++] = pModel->mCellRule[j];
+
+			for (i = 0; i < pModel->mInputNum && ++pos[i] == pActiveNum[i]; ++i)
+				pos[i] = 0;
+			if (i == pModel->mInputNum)
+				break;
+		}
+	}
+
+	return num;
+}
+
+// ---------------------------------------------------------------------------
+
+// Lists the rules of pModel that can fire for the input states pStates in
+// pRules, with their firing strength in pFiring. Returns the number of rules listed
+static int FuzzyModelFireStates(const FuzzyModel *pModel, const FuzzyInputState *pStates, unsigned char *pRules, float *pFiring)
+{
+	const unsigned char *pActive[FUZZY_INPUT_NUM_MAX];
+	int activeNum[FUZZY_INPUT_NUM_MAX];
+	int i, j, num;
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		pActive[i] = pStates[i].mpActive;
+		activeNum[i] = pStates[i].mActiveNum;
+	}
+
+	num = FuzzyModelCellRules(pModel, pActive, activeNum, pRules);
+
+	// The cell of a rule is its antecedent, the firing strength is the
+	// minimum of its memberships
+	for (j = 0; j < num; ++j)
+	{
+		int r = pRules[j];
+		float firing = pStates[0].mMu[pModel->mRuleMf[0][r]];
+
+		for (i = 1; i < pModel->mInputNum; ++i)
+			firing = FuzzyMin(firing, pStates[i].mMu[pModel->mRuleMf[i][r]]);
+
+		pFiring[j] = firing;
+	}
+
+	return num;
+}
+
+// ---------------------------------------------------------------------------
+
+// Same as FuzzyModelFireStates, computing the input states from pInputs
+static int FuzzyModelFire(const FuzzyModel *pModel, const float *pInputs, unsigned char *pRules, float *pFiring)
+{
+	FuzzyInputState states[FUZZY_INPUT_NUM_MAX];
+	int i;
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		FuzzyModelState(pModel, i, pInputs[i], states + i);
+		if (states[i].mActiveNum == 0)
+		{
+			return 0;
+		}
+	}
+
+	return FuzzyModelFireStates(pModel, states, pRules, pFiring);
+}
+
+// ---------------------------------------------------------------------------
+
+// Writes every output of pModel for the num rules listed by FuzzyModelFire
+static void FuzzyModelCombine(const FuzzyModel *pModel, const float *pInputs, const unsigned char *pRules, float *pFiring, int num, float *pOutputs)
+{
+	float denominator = 0.0f;
+	int i, j, o, r;
+
+	for (j = 0; j < num; ++j)
+		denominator += pFiring[j];
+
+#ifdef FUZZY_STATS
+	{
+		float weights[FUZZY_RULE_NUM_MAX];
+
+		for (j = 0; j < num; ++j)
+		{
+			r = pRules[j];
+			weights[j] = pModel->mRuleConst[0][r];
+			for (i = 0; i < pModel->mInputNum; ++i)
+				weights[j] += pModel->mRuleCoef[0][i][r] * pInputs[i];
+		}
+		FUZZY_STATS_RECORD(pModel, pRules, pFiring, weights, num, denominator);
+	}
+#endif
+
+	if (denominator <= 0.0f)
+	{
+		for (o = 0; o < pModel->mOutputNum; ++o)
+			pOutputs[o] = 0.0f;
+		return;
+	}
+
+	// Normalized firing strengths, shared by every output
+	for (j = 0; j < num; ++j)
+		pFiring[j] /= denominator;
+
+	for (o = 0; o < pModel->mOutputNum; ++o)
+	{
+		float output = 0.0f;
+
+		for (j = 0; j < num; ++j)
+		{
+			float w;
+
+			r = pRules[j];
+			w = pModel->mRuleConst[o][r];
+			for (i = 0; i < pModel->mInputNum; ++i)
+				w += pModel->mRuleCoef[o][i][r] * pInputs[i];
+
+			output += pFiring[j] * w;
+		}
+
+		pOutputs[o] = output;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyModelEvaluateSparse(const FuzzyModel *pModel, const float *pInputs)
+{
+	unsigned char rules[FUZZY_RULE_NUM_MAX];
+	float firing[FUZZY_RULE_NUM_MAX];
+	float numerator = 0.0f, denominator = 0.0f;
+	int i, j, r, num;
+#ifdef FUZZY_STATS
+	float weights[FUZZY_RULE_NUM_MAX];
+#endif
+
+	num = FuzzyModelFire(pModel, pInputs, rules, firing);
+
+	for (j = 0; j < num; ++j)
+	{
+		float w;
+
+		r = rules[j];
+		w = pModel->mRuleConst[0][r];
+		for (i = 0; i < pModel->mInputNum; ++i)
+			w += pModel->mRuleCoef[0][i][r] * pInputs[i];
+
+		numerator += firing[j] * w;
+		denominator += firing[j];
+#ifdef FUZZY_STATS
+		weights[j] = w;
+#endif
+	}
+
+	FUZZY_STATS_RECORD(pModel, rules, firing, weights, num, denominator);
+
+	if (denominator <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return numerator / denominator;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyModelEvaluateOutputs(const FuzzyModel *pModel, const float *pInputs, float *pOutputs)
+{
+	unsigned char rules[FUZZY_RULE_NUM_MAX];
+	float firing[FUZZY_RULE_NUM_MAX];
+	int num;
+
+	num = FuzzyModelFire(pModel, pInputs, rules, firing);
+	FuzzyModelCombine(pModel, pInputs, rules, firing, num, pOutputs);
+}
+
+// ---------------------------------------------------------------------------
+
+// Centroid of the classes of output o, each clipped at the strongest firing of its rules
+static float FuzzyModelCentroid(const FuzzyModel *pModel, int o, const unsigned char *pRules, const float *pFiring, int num)
+{
+	float height[FUZZY_MF_NUM_MAX];
+	float area = 0.0f, moment = 0.0f, heightSum = 0.0f, peakSum = 0.0f;
+	int j, m;
+
+	// Clipping height of every class: max aggregation of its rules
+	for (m = 0; m < pModel->mOutputMfNum[o]; ++m)
+		height[m] = 0.0f;
+	for (j = 0; j < num; ++j)
+	{
+		m = pModel->mRuleClass[o][pRules[j]];
+		height[m] = FuzzyMax(height[m], pFiring[j]);
+	}
+
+	// Triangle a b c clipped at h: rising edge a..x1, top x1..x2, falling edge x2..c
+	for (m = 0; m < pModel->mOutputMfNum[o]; ++m)
+	{
+		float h = height[m];
+		float a, b, c, x1, x2, left, top, right;
+
+		if (h <= 0.0f)
+			continue;
+
+		a = pModel->mOutputA[o][m];
+		b = pModel->mOutputB[o][m];
+		c = pModel->mOutputC[o][m];
+		x1 = a + h * (b - a);
+		x2 = c - h * (c - b);
+
+		left = 0.5f * h * (x1 - a);
+		top = h * (x2 - x1);
+		right = 0.5f * h * (c - x2);
+
+		area += left + top + right;
+		moment += left * (a + (2.0f / 3.0f) * (x1 - a)) + top * 0.5f * (x1 + x2) + right * (x2 + (1.0f / 3.0f) * (c - x2));
+		heightSum += h;
+		peakSum += h * b;
+	}
+
+	if (area > 0.0f)
+	{
+		return moment / area;
+	}
+
+	// Only point classes (a == c) fired: weighted average of their peaks
+	return heightSum > 0.0f ? peakSum / heightSum : 0.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyModelEvaluateMamdani(const FuzzyModel *pModel, const float *pInputs)
+{
+	unsigned char rules[FUZZY_RULE_NUM_MAX];
+	float firing[FUZZY_RULE_NUM_MAX];
+	int num;
+
+	num = FuzzyModelFire(pModel, pInputs, rules, firing);
+	return FuzzyModelCentroid(pModel, 0, rules, firing, num);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyModelInputState(const FuzzyModel *pModel, int input, float x, FuzzyInputState *pState)
+{
+	FuzzyModelState(pModel, input, x, pState);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyModelEvaluateStates(const FuzzyModel *pModel, const FuzzyInputState *pStates, const float *pInputs, float *pOutputs)
+{
+	unsigned char rules[FUZZY_RULE_NUM_MAX];
+	float firing[FUZZY_RULE_NUM_MAX];
+	int num;
+
+	num = FuzzyModelFireStates(pModel, pStates, rules, firing);
+	FuzzyModelCombine(pModel, pInputs, rules, firing, num, pOutputs);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyModelEvaluateStatesMamdani(const FuzzyModel *pModel, const FuzzyInputState *pStates, float *pOutputs)
+{
+	unsigned char rules[FUZZY_RULE_NUM_MAX];
+	float firing[FUZZY_RULE_NUM_MAX];
+	int o, num;
+
+	num = FuzzyModelFireStates(pModel, pStates, rules, firing);
+	for (o = 0; o < pModel->mOutputNum; ++o)
+		pOutputs[o] = FuzzyModelCentroid(pModel, o, rules, firing, num);
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyModelFiring(const FuzzyModel *pModel, const float *pInputs, unsigned char *pRules, float *pFiring)
+{
+	float denominator = 0.0f;
+	int j, num;
+
+	num = FuzzyModelFire(pModel, pInputs, pRules, pFiring);
+
+	for (j = 0; j < num; ++j)
+		denominator += pFiring[j];
+
+	if (denominator <= 0.0f)
+	{
+		return 0;
+	}
+
+	for (j = 0; j < num; ++j)
+		pFiring[j] /= denominator;
+
+	return num;
+}
+
+// ---------------------------------------------------------------------------
+
+unsigned int FuzzyModelHash(const FuzzyModel *pModel)
+{
+	// FNV-1a over the compiled tables (FuzzyModelCompile zeroes the unused entries)
+	const unsigned char *pByte = (const unsigned char *)pModel;
+	unsigned int hash = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < sizeof(FuzzyModel); ++i)
+	{
+		hash ^= pByte[i];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyTriangleEvaluate(const FuzzyTriangle *pMf, float x)
+{
+	if (x >= pMf->a && x <= pMf->b)
+	{
+		if (pMf->a == pMf->b)
+		{
+			return 1.0f;
+		}
+		else
+		{
+			return ((x - pMf->a) / (pMf->b - pMf->a));
+		}
+	}
+	else if (x > pMf->b && x <= pMf->c)
+	{
+		if (pMf->c == pMf->b)
+		{
+			return 1.0f;
+		}
+		else
+		{
+			return ((pMf->c - x) / (pMf->c - pMf->b));
+		}
+	}
+	else
+	{
+		return 0.0f;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyRuleBaseEvaluateReference(const FuzzyRuleBase *pRuleBase, const float *pInputs, int output)
+{
+	float numerator = 0.0f, denominator = 0.0f;
+	int i, r;
+
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+	{
+		const FuzzyTriangle *pOut = &pRuleBase->mOutputMf[output][pRuleBase->mRuleOutput[r][output]];
+		float firing = 1.0f;
+		float constant = pOut->b;
+		float w = 0.0f;
+
+		for (i = 0; i < pRuleBase->mInputNum; ++i)
+		{
+			const FuzzyTriangle *pMf = &pRuleBase->mInputMf[i][pRuleBase->mRuleMf[r][i]];
+			float coef = (pOut->c - pOut->a) / (pMf->c - pMf->a);
+
+			firing = FuzzyMin(firing, FuzzyTriangleEvaluate(pMf, pInputs[i]));
+			w += coef * pInputs[i];
+			constant -= coef * pMf->b;
+		}
+
+		numerator += firing * (w + constant);
+		denominator += firing;
+	}
+
+	if (denominator <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return numerator / denominator;
+}
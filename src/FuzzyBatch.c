@@ -0,0 +1,103 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyBatch.c
+Purpose:		SIMD evaluation of a fuzzy model for many bots
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "FuzzyBatch.h"
+#include "FuzzyVec.h"
+#include "FuzzyBatchLanes.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ---------------------------------------------------------------------------
+
+// Built with AVX, every file already needs it and the CPU is not checked
+#if !defined(__AVX__)
+
+// -1 until the CPU is checked, then 1 if the AVX kernel is used. Every
+// thread finds the same value, so the first calls may race harmlessly
+static int sgBatchAvx = -1;
+
+// ---------------------------------------------------------------------------
+
+// 1 if the CPU has AVX (CPUID 1: ECX bit 28) and the OS saves the 256 bit
+// registers: OSXSAVE (ECX bit 27), then XCR0 bits 1 and 2 (XMM and YMM state)
+static int FuzzyBatchCpuHasAvx(void)
+{
+#if defined(_MSC_VER)
+	int info[4];
+
+	__cpuid(info, 1);
+	if ((info[2] & (3 << 27)) != (3 << 27))
+		return 0;
+	return (_xgetbv(0) & 6) == 6;
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx");
+#else
+	return 0;
+#endif
+}
+
+// Sets sgBatchAvx on the first call
+static void FuzzyBatchCheckCpu(void)
+{
+	if (sgBatchAvx < 0)
+		sgBatchAvx = FuzzyBatchAvxIsBuilt() && FuzzyBatchCpuHasAvx();
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+
+void FuzzyModelEvaluateBatch(const FuzzyModel *pModel, const float *const *ppInputs, float *pOutputs, int num)
+{
+	float inputs[FUZZY_INPUT_NUM_MAX];
+	int bot = 0, i;
+
+#if !defined(__AVX__)
+	FuzzyBatchCheckCpu();
+	if (sgBatchAvx)
+		bot = FuzzyModelEvaluateBatchAvx(pModel, ppInputs, pOutputs, num);
+#endif
+
+#if FUZZY_VEC_LANES > 1
+	for (; bot + FUZZY_VEC_LANES <= num; bot += FUZZY_VEC_LANES)
+	{
+		FuzzyModelEvaluateLanes(pModel, ppInputs, pOutputs, bot);
+	}
+#endif
+
+	// Remaining bots, one at a time
+	for (; bot < num; ++bot)
+	{
+		for (i = 0; i < pModel->mInputNum; ++i)
+			inputs[i] = ppInputs[i][bot];
+
+		pOutputs[bot] = FuzzyModelEvaluate(pModel, inputs);
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+const char *FuzzyBatchGetKernelName(void)
+{
+#if !defined(__AVX__)
+	FuzzyBatchCheckCpu();
+	if (sgBatchAvx)
+		return "AVX";
+#endif
+	return FUZZY_VEC_NAME;
+}
@@ -0,0 +1,55 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyBatchAvx.c
+Purpose:		AVX kernel of FuzzyModelEvaluateBatch
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+// This file is built with /arch:AVX (see the project file) whatever the
+// instruction set of the rest of the project. Its code only runs once
+// FuzzyModelEvaluateBatch has checked that the CPU has AVX
+
+#include "FuzzyBatch.h"
+#include "FuzzyVec.h"
+#include "FuzzyBatchLanes.h"
+
+// ---------------------------------------------------------------------------
+
+int FuzzyModelEvaluateBatchAvx(const FuzzyModel *pModel, const float *const *ppInputs, float *pOutputs, int num)
+{
+	int bot = 0;
+
+#if defined(__AVX__)
+	for (; bot + FUZZY_VEC_LANES <= num; bot += FUZZY_VEC_LANES)
+	{
+		FuzzyModelEvaluateLanes(pModel, ppInputs, pOutputs, bot);
+	}
+#else
+	(void)pModel;
+	(void)ppInputs;
+	(void)pOutputs;
+	(void)num;
+#endif
+
+	return bot;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyBatchAvxIsBuilt(void)
+{
+#if defined(__AVX__)
+	return 1;
+#else
+	return 0;
+#endif
+}
@@ -0,0 +1,682 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyBench.c
+Purpose:		Micro benchmarks of the fuzzy evaluators
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "AEEngine.h"
+#include "FuzzyBench.h"
+#include "FuzzyCheck.h"
+#include "FuzzyBatch.h"
+#include "FuzzyCache.h"
+#include "FuzzyMemo.h"
+#include "FuzzyBotGenerated.h"
+#include "FuzzyFixed.h"
+#include "FuzzyMembership.h"
+#include "FuzzyTrain.h"
+#include "FuzzyStats.h"
+#include "BotPerception.h"
+#include "BotThreat.h"
+#include "BotInfluence.h"
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+// ---------------------------------------------------------------------------
+
+// Output of an evaluator for one input triple, pContext is what it evaluates
+typedef float (*FuzzyBenchEval)(void *pContext, const float *pInputs);
+
+static float sgBenchInputs[FUZZY_BENCH_SAMPLE_NUM][FUZZY_INPUT_NUM_MAX];
+static float sgBenchBatchInputs[FUZZY_INPUT_NUM_MAX][FUZZY_BENCH_SAMPLE_NUM];	// sgBenchInputs, one array per input
+static float sgBenchBatchOutputs[FUZZY_BENCH_SAMPLE_NUM];
+static float sgBenchMu[FUZZY_MF_NUM_MAX * FUZZY_BENCH_SAMPLE_NUM];				// Memberships of one input, one row per function
+static FuzzyRuleBase sgBenchMultiRuleBase;											// Rule base under test with FUZZY_OUTPUT_NUM_MAX outputs
+static FuzzyModel sgBenchMultiModel;
+static float sgBenchTrack[FUZZY_BENCH_SAMPLE_NUM][FUZZY_INPUT_NUM_MAX];			// Inputs of consecutive frames of a match
+static FuzzyFixedModel sgBenchFixedModel;
+static FuzzyModel sgBenchTrainModel;
+static FuzzyChain sgBenchChain;
+static FuzzyRuleBase sgBenchChainRuleBase;										// Second stage of the chain under test
+static BotPerception sgBenchPerception;
+static float sgBenchBotX[BOT_PERCEPTION_BOT_NUM_MAX], sgBenchBotY[BOT_PERCEPTION_BOT_NUM_MAX];				// Bots of the perception timing
+static float sgBenchForwardX[BOT_PERCEPTION_BOT_NUM_MAX], sgBenchForwardY[BOT_PERCEPTION_BOT_NUM_MAX];
+static BotThreatGrid sgBenchThreatGrid, sgBenchThreatScan;						// Threat query timing: grid, and a single cell
+static float sgBenchBulletX[FUZZY_BENCH_THREAT_BULLET_NUM], sgBenchBulletY[FUZZY_BENCH_THREAT_BULLET_NUM];
+static float sgBenchBulletVelocityX[FUZZY_BENCH_THREAT_BULLET_NUM], sgBenchBulletVelocityY[FUZZY_BENCH_THREAT_BULLET_NUM];
+static BotInfluence sgBenchInfluence;
+static float sgBenchInfluenceSamples[BOT_PERCEPTION_BOT_NUM_MAX];
+#ifdef FUZZY_STATS
+static FuzzyStats sgBenchStats;
+#endif
+
+// Keeps the compiler from dropping the evaluations
+static volatile float sgBenchSink;
+
+// ---------------------------------------------------------------------------
+
+static void FuzzyBenchReport(const char *pName, clock_t ticks, double evaluationNum)
+{
+	AESysPrintf("  %-28s %8.1f ns/eval\n", pName, (double)ticks / CLOCKS_PER_SEC * 1.0e9 / evaluationNum);
+}
+
+// Times eval on every one of the FUZZY_BENCH_SAMPLE_NUM inputs pSamples, passNum times over
+static void FuzzyBenchTime(const char *pName, FuzzyBenchEval eval, void *pContext, float (*pSamples)[FUZZY_INPUT_NUM_MAX], int passNum)
+{
+	clock_t start = clock();
+	float sum = 0.0f;
+	int s, pass;
+
+	for (pass = 0; pass < passNum; ++pass)
+		for (s = 0; s < FUZZY_BENCH_SAMPLE_NUM; ++s)
+			sum += eval(pContext, pSamples[s]);
+	sgBenchSink = sum;
+
+	FuzzyBenchReport(pName, clock() - start, (double)FUZZY_BENCH_SAMPLE_NUM * passNum);
+}
+
+// ---------------------------------------------------------------------------
+
+// Number of rules of pModel with a non-zero firing strength for pInputs
+static int FuzzyBenchFiringRuleNum(const FuzzyModel *pModel, const float *pInputs)
+{
+	int i, r, num = 0;
+
+	for (r = 0; r < pModel->mRuleNum; ++r)
+	{
+		for (i = 0; i < pModel->mInputNum; ++i)
+		{
+			int m = pModel->mRuleMf[i][r];
+			float x = pInputs[i];
+			float left = (x - pModel->mMfA[i][m]) * pModel->mMfInvL[i][m] + pModel->mMfBiasL[i][m];
+			float right = (pModel->mMfC[i][m] - x) * pModel->mMfInvR[i][m] + pModel->mMfBiasR[i][m];
+
+			if (left <= 0.0f || right <= 0.0f)
+				break;
+		}
+		if (i == pModel->mInputNum)
+			++num;
+	}
+
+	return num;
+}
+
+// ---------------------------------------------------------------------------
+
+// The original getFuzzyOutputY of GameState_Asteroids.c, the baseline every
+// evaluator is timed against: the default rules hard coded, every rule's
+// Sugeno form derived again on every call, without the final clamp
+static float FuzzyBenchEvalOriginal(void *pContext, const float *pInputs)
+{
+	float x = pInputs[0], y = pInputs[1], z = pInputs[2];
+	int i = 0, h, a, p, o;
+	float hh, aa, pp, numerator, denominator;
+
+	float HP[3][3] = {
+		{0.0f,0.0f,50.0f},
+		{25.0f,50.0f,75.0f},
+		{50.0f,100.0f,100.0f}
+	};
+	float AM[2][3] = {
+		{0.0f,0.0f,3.5f},
+		{1.5f,5.0f,5.0f}
+	};
+	float P[3][3] = {
+		{0.0f,0.0f,200.0f},
+		{100.0f,175.0f,250.0f},
+		{150.0f,300.0f,300.0f}
+	};
+	float BY[3][3] = {
+		{0.0f,0.0f,150.0f},			//OF - 11,14,15,17
+		{100.0f,175.0f,250.0f},		//NO - 1,2,4,5,8,9,10,12,13,16
+		{150.0f,300.0f,300.0f}		//DF - 0,3,6,7
+	};
+	float firings[18], w[18];
+	float alpha, beta, gamma, constant;
+
+	(void)pContext;
+	for (h = 0; h < 3; ++h)
+	{
+		FuzzyTriangle mfH = { HP[h][0], HP[h][1], HP[h][2] };
+
+		hh = FuzzyTriangleEvaluate(&mfH, x);
+		for (a = 0; a < 2; ++a)
+		{
+			FuzzyTriangle mfA = { AM[a][0], AM[a][1], AM[a][2] };
+
+			aa = FuzzyTriangleEvaluate(&mfA, y);
+			for (p = 0; p < 3; ++p)
+			{
+				FuzzyTriangle mfP = { P[p][0], P[p][1], P[p][2] };
+
+				pp = FuzzyTriangleEvaluate(&mfP, z);
+				if (i == 0 || i == 3 || i == 6 || i == 7)
+				{
+					o = 2;
+				}
+				else if (i == 11 || i == 14 || i == 15 || i == 17)
+				{
+					o = 0;
+				}
+				else
+				{
+					o = 1;
+				}
+				alpha = (BY[o][2] - BY[o][0]) / (HP[h][2] - HP[h][0]);
+				beta = (BY[o][2] - BY[o][0]) / (AM[a][2] - AM[a][0]);
+				gamma = (BY[o][2] - BY[o][0]) / (P[p][2] - P[p][0]);
+				constant = BY[o][1] - (alpha*HP[h][1]) - (beta*AM[a][1]) - (gamma*P[p][1]);
+				firings[i] = min(hh, min(aa, pp));
+				w[i] = alpha * x + beta * y + gamma * z + constant;
+				++i;
+			}
+		}
+	}
+
+	numerator = denominator = 0.0f;
+
+	for (i = 0; i < 18; ++i)
+	{
+		numerator += firings[i] * w[i];
+		denominator += firings[i];
+	}
+
+	return numerator / denominator;
+}
+
+// Every membership of every input with Triangle(), one at a time
+static float FuzzyBenchEvalTriangles(void *pContext, const float *pInputs)
+{
+	const FuzzyRuleBase *pRuleBase = (const FuzzyRuleBase *)pContext;
+	float sum = 0.0f;
+	int i, m;
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+		for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+			sum += FuzzyTriangleEvaluate(&pRuleBase->mInputMf[i][m], pInputs[i]);
+
+	return sum;
+}
+
+// Every membership of every input, one set per input (pContext: FUZZY_INPUT_NUM_MAX sets)
+static float FuzzyBenchEvalSets(void *pContext, const float *pInputs)
+{
+	const FuzzyMfSet *pSets = (const FuzzyMfSet *)pContext;
+	float mu[FUZZY_MF_NUM_MAX], sum = 0.0f;
+	int i;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		FuzzyMfSetEvaluate(pSets + i, pInputs[i], mu);
+		sum += mu[0];
+	}
+
+	return sum;
+}
+
+static float FuzzyBenchEvalReference(void *pContext, const float *pInputs)
+{
+	return FuzzyRuleBaseEvaluateReference((const FuzzyRuleBase *)pContext, pInputs, 0);
+}
+
+static float FuzzyBenchEvalAllRules(void *pContext, const float *pInputs)
+{
+	return FuzzyModelEvaluate((const FuzzyModel *)pContext, pInputs);
+}
+
+static float FuzzyBenchEvalActiveRules(void *pContext, const float *pInputs)
+{
+	return FuzzyModelEvaluateSparse((const FuzzyModel *)pContext, pInputs);
+}
+
+static float FuzzyBenchEvalGenerated(void *pContext, const float *pInputs)
+{
+	float output;
+
+	(void)pContext;
+	FuzzyBotEvaluate(pInputs, &output);
+	return output;
+}
+
+// Inputs converted to fixed point and the first output back, as the game does
+static float FuzzyBenchEvalFixed(void *pContext, const float *pInputs)
+{
+	FuzzyFixed inputs[FUZZY_INPUT_NUM_MAX], outputs[FUZZY_OUTPUT_NUM_MAX];
+	int i;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		inputs[i] = FuzzyFixedFromFloat(pInputs[i]);
+	FuzzyFixedModelEvaluate((const FuzzyFixedModel *)pContext, inputs, outputs);
+	return FuzzyFixedToFloat(outputs[0]);
+}
+
+static float FuzzyBenchEvalOutputs(void *pContext, const float *pInputs)
+{
+	float outputs[FUZZY_OUTPUT_NUM_MAX];
+
+	FuzzyModelEvaluateOutputs((const FuzzyModel *)pContext, pInputs, outputs);
+	return outputs[FUZZY_OUTPUT_NUM_MAX - 1];
+}
+
+static float FuzzyBenchEvalMamdani(void *pContext, const float *pInputs)
+{
+	return FuzzyModelEvaluateMamdani((const FuzzyModel *)pContext, pInputs);
+}
+
+static float FuzzyBenchEvalMamdaniSampled(void *pContext, const float *pInputs)
+{
+	return FuzzyCheckMamdaniSampled((const FuzzyRuleBase *)pContext, pInputs);
+}
+
+static float FuzzyBenchEvalChain(void *pContext, const float *pInputs)
+{
+	return FuzzyChainEvaluate((const FuzzyChain *)pContext, pInputs);
+}
+
+static float FuzzyBenchEvalCache(void *pContext, const float *pInputs)
+{
+	float outputs[FUZZY_OUTPUT_NUM_MAX];
+
+	FuzzyCacheEvaluate((FuzzyCache *)pContext, pInputs, outputs);
+	return outputs[0];
+}
+
+static float FuzzyBenchEvalMemo(void *pContext, const float *pInputs)
+{
+	return FuzzyMemoEvaluate((FuzzyMemo *)pContext, 0, pInputs);
+}
+
+static float FuzzyBenchEvalSurface(void *pContext, const float *pInputs)
+{
+	return FuzzySurfaceEvaluate((const FuzzySurface *)pContext, pInputs);
+}
+
+static float FuzzyBenchEvalOctree(void *pContext, const float *pInputs)
+{
+	return FuzzyOctreeEvaluate((const FuzzyOctree *)pContext, pInputs);
+}
+
+// ---------------------------------------------------------------------------
+
+// Times the memberships of every input's functions, per input triple
+static void FuzzyBenchMembership(const FuzzyRuleBase *pRuleBase)
+{
+	FuzzyMfSet sets[FUZZY_INPUT_NUM_MAX];
+	clock_t start;
+	int i, pass;
+
+	memset(sets, 0, sizeof(sets));
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+		FuzzyMfSetCompileTriangles(&sets[i], pRuleBase->mInputMf[i], pRuleBase->mMfNum[i]);
+
+	FuzzyBenchTime("memberships: Triangle()", FuzzyBenchEvalTriangles, (void *)pRuleBase, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+	FuzzyBenchTime("memberships: set", FuzzyBenchEvalSets, sets, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+
+	// Every function of an input on every sample at once
+	start = clock();
+	for (pass = 0; pass < FUZZY_BENCH_PASS_NUM; ++pass)
+		for (i = 0; i < pRuleBase->mInputNum; ++i)
+			FuzzyMfSetEvaluateArray(&sets[i], sgBenchBatchInputs[i], FUZZY_BENCH_SAMPLE_NUM, sgBenchMu);
+	FuzzyBenchReport("memberships: set, arrays", clock() - start, (double)FUZZY_BENCH_SAMPLE_NUM * FUZZY_BENCH_PASS_NUM);
+}
+
+// Times FuzzyModelEvaluateSparse and FuzzyCacheEvaluate on the frames of a
+// simulated match (FuzzyCheckMatch)
+static void FuzzyBenchCache(const FuzzyModel *pModel)
+{
+	float epsilon[FUZZY_INPUT_NUM_MAX] = { 0.0f, 0.0f, FUZZY_BENCH_CACHE_EPSILON };
+	FuzzyCache cache;
+
+	FuzzyCheckMatch(sgBenchTrack, FUZZY_BENCH_SAMPLE_NUM);
+	FuzzyBenchTime("match (active rules)", FuzzyBenchEvalActiveRules, (void *)pModel, sgBenchTrack, FUZZY_BENCH_PASS_NUM);
+
+	FuzzyCacheInit(&cache, pModel, epsilon);
+	FuzzyBenchTime("match (incremental)", FuzzyBenchEvalCache, &cache, sgBenchTrack, FUZZY_BENCH_PASS_NUM);
+	AESysPrintf("  incremental: %u hits, %u partial, %u misses\n", cache.mHitNum, cache.mPartialNum, cache.mMissNum);
+}
+
+// Times FuzzyMemoEvaluate on the random samples and on the simulated match
+// of FuzzyBenchCache. The output is clamped to the range of pSurface, not
+// clamped if pSurface is 0. Each case starts from an empty memo, the hit
+// rate covers all the passes
+static void FuzzyBenchMemo(const FuzzyModel *pModel, const FuzzySurface *pSurface)
+{
+	static const char *pNames[2] = { "memo (random)", "memo (match)" };
+	float step[FUZZY_INPUT_NUM_MAX] = { 1.0f, 1.0f, FUZZY_BENCH_MEMO_STEP };
+	FuzzyMemo memo;
+	unsigned int hitNum, missNum;
+	int c;
+
+	memset(&memo, 0, sizeof(FuzzyMemo));
+	if (!FuzzyMemoInit(&memo, pModel, step, pSurface ? pSurface->mOutMin : -FLT_MAX, pSurface ? pSurface->mOutMax : FLT_MAX, FUZZY_BENCH_MEMO_ENTRY_NUM, 1))
+	{
+		return;
+	}
+
+	for (c = 0; c < 2; ++c)
+	{
+		FuzzyMemoClear(&memo);
+		FuzzyBenchTime(pNames[c], FuzzyBenchEvalMemo, &memo, c == 0 ? sgBenchInputs : sgBenchTrack, FUZZY_BENCH_PASS_NUM);
+		FuzzyMemoGetStats(&memo, &hitNum, &missNum);
+		AESysPrintf("  %s: %.1f%% hits\n", pNames[c], 100.0 * hitNum / (hitNum + missNum));
+	}
+
+	FuzzyMemoFree(&memo);
+}
+
+// Original FindPlayer of GameState_Asteroids.c: lateral distance from the angle
+static float FuzzyBenchLateral(float forwardX, float forwardY, float offsetX, float offsetY)
+{
+	float dot = forwardX * offsetX + forwardY * offsetY;
+	float lengthF = sqrtf(forwardX * forwardX + forwardY * forwardY), lengthO = sqrtf(offsetX * offsetX + offsetY * offsetY);
+	float angle = acosf(max(-1.0f, min(1.0f, dot / (lengthF * lengthO))));
+
+	if (-offsetY * forwardX + offsetX * forwardY > 0.0f)
+	{
+		angle = -angle;
+	}
+
+	return sinf(angle) * lengthO;
+}
+
+// Times BotPerceptionUpdate on every pair of BOT_PERCEPTION_BOT_NUM_MAX bots
+// and BOT_PERCEPTION_TARGET_NUM_MAX targets against the original FindPlayer
+static void FuzzyBenchPerception(void)
+{
+	float targetX[BOT_PERCEPTION_TARGET_NUM_MAX], targetY[BOT_PERCEPTION_TARGET_NUM_MAX];
+	const int pairNum = BOT_PERCEPTION_BOT_NUM_MAX * BOT_PERCEPTION_TARGET_NUM_MAX;
+	const int passNum = FUZZY_BENCH_SAMPLE_NUM * FUZZY_BENCH_PASS_NUM / pairNum;
+	clock_t start;
+	float sum;
+	int b, t, pass;
+
+	FuzzyCheckScatter(targetX, targetY, 0, 0, BOT_PERCEPTION_TARGET_NUM_MAX, 0.0f);
+	FuzzyCheckScatter(sgBenchBotX, sgBenchBotY, sgBenchForwardX, sgBenchForwardY, BOT_PERCEPTION_BOT_NUM_MAX, 1.0f);
+
+	sum = 0.0f;
+	start = clock();
+	for (pass = 0; pass < passNum; ++pass)
+	{
+		BotPerceptionUpdate(&sgBenchPerception, sgBenchBotX, sgBenchBotY, sgBenchForwardX, sgBenchForwardY, BOT_PERCEPTION_BOT_NUM_MAX,
+			targetX, targetY, BOT_PERCEPTION_TARGET_NUM_MAX);
+		sum += sgBenchPerception.mLateral[pass % BOT_PERCEPTION_TARGET_NUM_MAX][pass % BOT_PERCEPTION_BOT_NUM_MAX];
+	}
+	sgBenchSink = sum;
+	FuzzyBenchReport("perception (batched)", clock() - start, (double)pairNum * passNum);
+
+	sum = 0.0f;
+	start = clock();
+	for (pass = 0; pass < passNum; ++pass)
+		for (t = 0; t < BOT_PERCEPTION_TARGET_NUM_MAX; ++t)
+			for (b = 0; b < BOT_PERCEPTION_BOT_NUM_MAX; ++b)
+				sum += FuzzyBenchLateral(sgBenchForwardX[b], sgBenchForwardY[b], targetX[t] - sgBenchBotX[b], targetY[t] - sgBenchBotY[b]);
+	sgBenchSink = sum;
+	FuzzyBenchReport("perception (FindPlayer)", clock() - start, (double)pairNum * passNum);
+}
+
+// ---------------------------------------------------------------------------
+
+// Times BotThreatQuery for BOT_PERCEPTION_BOT_NUM_MAX bots and
+// FUZZY_BENCH_THREAT_BULLET_NUM bullets flying at 700 in an 800 x 600
+// viewport, the grid rebuilt every pass as every frame, against a grid of
+// one cell, i.e. every bullet tested by every bot
+static void FuzzyBenchThreat(void)
+{
+	const int passNum = FUZZY_BENCH_SAMPLE_NUM * FUZZY_BENCH_PASS_NUM / BOT_PERCEPTION_BOT_NUM_MAX;
+	clock_t start;
+	BotThreat threat;
+	float sum;
+	int b, pass, threatNum;
+
+	FuzzyCheckScatter(sgBenchBulletX, sgBenchBulletY, sgBenchBulletVelocityX, sgBenchBulletVelocityY, FUZZY_BENCH_THREAT_BULLET_NUM, 700.0f);
+	FuzzyCheckScatter(sgBenchBotX, sgBenchBotY, 0, 0, BOT_PERCEPTION_BOT_NUM_MAX, 0.0f);
+	BotThreatGridInit(&sgBenchThreatGrid, 64.0f, 40.0f, 0.5f);
+	BotThreatGridInit(&sgBenchThreatScan, 1000.0f, 40.0f, 0.5f);
+
+	sum = 0.0f;
+	start = clock();
+	for (pass = 0; pass < passNum; ++pass)
+	{
+		BotThreatGridBuild(&sgBenchThreatGrid, -400.0f, -300.0f, 400.0f, 300.0f, sgBenchBulletX, sgBenchBulletY,
+			sgBenchBulletVelocityX, sgBenchBulletVelocityY, FUZZY_BENCH_THREAT_BULLET_NUM);
+		for (b = 0; b < BOT_PERCEPTION_BOT_NUM_MAX; ++b)
+		{
+			BotThreatQuery(&sgBenchThreatGrid, sgBenchBotX[b], sgBenchBotY[b], &threat);
+			sum += threat.mTime;
+		}
+	}
+	sgBenchSink = sum;
+	FuzzyBenchReport("threat (grid)", clock() - start, (double)BOT_PERCEPTION_BOT_NUM_MAX * passNum);
+
+	BotThreatGridBuild(&sgBenchThreatScan, -400.0f, -300.0f, 400.0f, 300.0f, sgBenchBulletX, sgBenchBulletY,
+		sgBenchBulletVelocityX, sgBenchBulletVelocityY, FUZZY_BENCH_THREAT_BULLET_NUM);
+	sum = 0.0f;
+	threatNum = 0;
+	start = clock();
+	for (pass = 0; pass < passNum; ++pass)
+		for (b = 0; b < BOT_PERCEPTION_BOT_NUM_MAX; ++b)
+		{
+			BotThreatQuery(&sgBenchThreatScan, sgBenchBotX[b], sgBenchBotY[b], &threat);
+			sum += threat.mTime;
+			threatNum += threat.mBulletNum;
+		}
+	sgBenchSink = sum;
+	FuzzyBenchReport("threat (every bullet)", clock() - start, (double)BOT_PERCEPTION_BOT_NUM_MAX * passNum);
+	AESysPrintf("  threat: %d bullets, %d cells, %d bullet entries, %.2f threats per bot\n",
+		sgBenchThreatGrid.mBulletNum, sgBenchThreatGrid.mCellNumX * sgBenchThreatGrid.mCellNumY,
+		sgBenchThreatGrid.mCellStart[sgBenchThreatGrid.mCellNumX * sgBenchThreatGrid.mCellNumY],
+		(double)threatNum / ((double)BOT_PERCEPTION_BOT_NUM_MAX * passNum));
+}
+
+// ---------------------------------------------------------------------------
+
+// Times the frames of an influence map over an 800 x 600 viewport: the
+// update, FUZZY_BENCH_INFLUENCE_BULLET_NUM bullet moves and a line of fire
+// stamped, and both layers sampled for BOT_PERCEPTION_BOT_NUM_MAX bots at once
+static void FuzzyBenchInfluence(void)
+{
+	const int passNum = FUZZY_BENCH_SAMPLE_NUM * FUZZY_BENCH_PASS_NUM / BOT_PERCEPTION_BOT_NUM_MAX;
+	clock_t start, updateTicks;
+	float sum;
+	int b, k, pass;
+
+	FuzzyCheckScatter(sgBenchBulletX, sgBenchBulletY, sgBenchBulletVelocityX, sgBenchBulletVelocityY, FUZZY_BENCH_INFLUENCE_BULLET_NUM, 700.0f);
+	FuzzyCheckScatter(sgBenchBotX, sgBenchBotY, 0, 0, BOT_PERCEPTION_BOT_NUM_MAX, 0.0f);
+	BotInfluenceInit(&sgBenchInfluence, -400.0f, -300.0f, 400.0f, 300.0f, 25.0f, 0.9f, 0.7f);
+
+	sum = 0.0f;
+	start = clock();
+	for (pass = 0; pass < passNum; ++pass)
+	{
+		float shipX = (float)(pass % 800) - 400.0f;
+
+		BotInfluenceUpdate(&sgBenchInfluence);
+
+		// A sixtieth of a second of the bullets, wrapped around the viewport
+		for (b = 0; b < FUZZY_BENCH_INFLUENCE_BULLET_NUM; ++b)
+		{
+			float x = sgBenchBulletX[b] + sgBenchBulletVelocityX[b] * (pass % 64) / 60.0f;
+			float y = sgBenchBulletY[b] + sgBenchBulletVelocityY[b] * (pass % 64) / 60.0f;
+
+			BotInfluenceStamp(&sgBenchInfluence, BOT_INFLUENCE_DANGER, x - sgBenchBulletVelocityX[b] / 60.0f,
+				y - sgBenchBulletVelocityY[b] / 60.0f, x, y, 40.0f, 1.0f);
+		}
+		BotInfluenceStamp(&sgBenchInfluence, BOT_INFLUENCE_DANGER, shipX, -270.0f, shipX, 300.0f, 20.0f, 0.5f);
+		BotInfluenceStamp(&sgBenchInfluence, BOT_INFLUENCE_OPPORTUNITY, shipX, -270.0f, shipX, 300.0f, 120.0f, 1.0f);
+
+		for (k = 0; k < BOT_INFLUENCE_NUM; ++k)
+		{
+			BotInfluenceSampleBatch(&sgBenchInfluence, k, sgBenchBotX, sgBenchBotY, BOT_PERCEPTION_BOT_NUM_MAX, sgBenchInfluenceSamples);
+			sum += sgBenchInfluenceSamples[pass % BOT_PERCEPTION_BOT_NUM_MAX];
+		}
+	}
+	sgBenchSink = sum;
+	FuzzyBenchReport("influence (frame per bot)", clock() - start, (double)BOT_PERCEPTION_BOT_NUM_MAX * passNum);
+
+	// The update alone, on the last frame's map
+	start = clock();
+	for (pass = 0; pass < passNum; ++pass)
+		BotInfluenceUpdate(&sgBenchInfluence);
+	updateTicks = clock() - start;
+
+	AESysPrintf("  influence: %d x %d cells of %g, update %.2f us per frame, %d bullets stamped\n",
+		sgBenchInfluence.mTileNumX * BOT_INFLUENCE_TILE, sgBenchInfluence.mTileNumY * BOT_INFLUENCE_TILE, sgBenchInfluence.mCellSize,
+		(double)updateTicks / CLOCKS_PER_SEC * 1.0e6 / passNum, FUZZY_BENCH_INFLUENCE_BULLET_NUM);
+}
+
+// ---------------------------------------------------------------------------
+
+// Consequents of the model zeroed, then trained back from samples of the model itself
+static void FuzzyBenchTrain(const FuzzyModel *pModel)
+{
+	FuzzyDataset dataset;
+	FuzzyTrainStats stats;
+	clock_t start, ticks;
+	float inputs[FUZZY_INPUT_NUM_MAX], maxError;
+	int s;
+
+	if (!FuzzyDatasetOpen(&dataset, FUZZY_BENCH_TRAIN_FILE, pModel->mInputNum))
+	{
+		AESysPrintf("  training: %s\n", FuzzyTrainGetError());
+		return;
+	}
+	for (s = 0; s < FUZZY_BENCH_TRAIN_SAMPLE_NUM; ++s)
+	{
+		FuzzyCheckSample(inputs);
+		FuzzyDatasetAdd(&dataset, inputs, FuzzyModelEvaluateSparse(pModel, inputs));
+	}
+	FuzzyDatasetClose(&dataset);
+
+	sgBenchTrainModel = *pModel;
+	memset(sgBenchTrainModel.mRuleCoef[0], 0, sizeof(sgBenchTrainModel.mRuleCoef[0]));
+	memset(sgBenchTrainModel.mRuleConst[0], 0, sizeof(sgBenchTrainModel.mRuleConst[0]));
+
+	start = clock();
+	if (!FuzzyModelTrain(&sgBenchTrainModel, 0, FUZZY_BENCH_TRAIN_FILE, FUZZY_TRAIN_RIDGE, &stats))
+	{
+		AESysPrintf("  training: %s\n", FuzzyTrainGetError());
+		remove(FUZZY_BENCH_TRAIN_FILE);
+		return;
+	}
+	ticks = clock() - start;
+	remove(FUZZY_BENCH_TRAIN_FILE);
+
+	maxError = 0.0f;
+	for (s = 0; s < FUZZY_BENCH_SAMPLE_NUM; ++s)
+		maxError = max(maxError, fabsf(FuzzyModelEvaluateSparse(&sgBenchTrainModel, sgBenchInputs[s]) - FuzzyModelEvaluateSparse(pModel, sgBenchInputs[s])));
+
+	AESysPrintf("  training: %u samples (%u skipped) in %.0f ms, RMS error %g -> %g, max deviation %g\n",
+		stats.mSampleNum, stats.mSkipNum, (double)ticks * 1000.0 / CLOCKS_PER_SEC, stats.mErrorBefore, stats.mErrorAfter, maxError);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyBenchRun(const FuzzyRuleBase *pRuleBase, const FuzzyModel *pModel, const FuzzySurface *pSurface, const FuzzyOctree *pOctree)
+{
+	clock_t start;
+	const float *pBatchInputs[FUZZY_INPUT_NUM_MAX];
+	int s, i, pass, firingNum = 0;
+
+	srand(562);
+	for (s = 0; s < FUZZY_BENCH_SAMPLE_NUM; ++s)
+	{
+		FuzzyCheckSample(sgBenchInputs[s]);
+		for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+			sgBenchBatchInputs[i][s] = sgBenchInputs[s][i];
+		firingNum += FuzzyBenchFiringRuleNum(pModel, sgBenchInputs[s]);
+	}
+
+	AESysPrintf("Fuzzy benchmark: %d rules, %.2f firing per evaluation on average (deviations: \"-test\", FuzzyCheck.h)\n",
+		pModel->mRuleNum, (float)firingNum / FUZZY_BENCH_SAMPLE_NUM);
+
+	// Every timing below includes the recording
+#ifdef FUZZY_STATS
+	FuzzyStatsAttach(&sgBenchStats, pModel);
+	AESysPrintf("  rule statistics recorded (FUZZY_STATS)\n");
+#endif
+
+	FuzzyBenchMembership(pRuleBase);
+
+	// Baseline: the game's original evaluation
+	FuzzyBenchTime("original (triple loop)", FuzzyBenchEvalOriginal, 0, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+
+	// Every rule re-derived and evaluated on the fly, from any rule base
+	FuzzyBenchTime("reference (all rules)", FuzzyBenchEvalReference, (void *)pRuleBase, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+
+	FuzzyBenchTime("compiled (all rules)", FuzzyBenchEvalAllRules, (void *)pModel, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+	FuzzyBenchTime("compiled (active rules)", FuzzyBenchEvalActiveRules, (void *)pModel, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+
+	// Unrolled code generated from the same rules (FuzzyCodegen.h)
+	if (FuzzyBotEvaluateHash() == FuzzyModelHash(pModel))
+		FuzzyBenchTime("generated (unrolled)", FuzzyBenchEvalGenerated, 0, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+	else
+		AESysPrintf("  generated: built from other rules, skipped\n");
+
+	// Integer only inference
+	FuzzyFixedModelCompile(&sgBenchFixedModel, pModel);
+	FuzzyBenchTime("fixed point", FuzzyBenchEvalFixed, &sgBenchFixedModel, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+
+	// Several outputs sharing the firing strengths
+	FuzzyCheckMultiOutput(&sgBenchMultiRuleBase, pRuleBase);
+	FuzzyModelCompile(&sgBenchMultiModel, &sgBenchMultiRuleBase);
+	FuzzyBenchTime("compiled (all outputs)", FuzzyBenchEvalOutputs, &sgBenchMultiModel, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+
+	// True Mamdani centroid, next to the Sugeno form above. The sampled one on one pass only
+	FuzzyBenchTime("mamdani (closed form)", FuzzyBenchEvalMamdani, (void *)pModel, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+	FuzzyBenchTime("mamdani (sampled)", FuzzyBenchEvalMamdaniSampled, (void *)pRuleBase, sgBenchInputs, 1);
+
+	// Hierarchical system, one stage feeding the next
+	if (FuzzyCheckChain(&sgBenchChain, &sgBenchChainRuleBase, pRuleBase))
+		FuzzyBenchTime("chain (2 stages)", FuzzyBenchEvalChain, &sgBenchChain, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+	else
+		AESysPrintf("  chain: %s, skipped\n", FuzzyChainGetError());
+
+	// Lateral offsets of many bots at once, next to FindPlayer
+	FuzzyBenchPerception();
+
+	// Incoming bullets of many bots, from a grid of their paths
+	FuzzyBenchThreat();
+
+	// Danger and opportunity around many bots, from a decaying map
+	FuzzyBenchInfluence();
+
+	// Consecutive frames, re-evaluating only what moved
+	FuzzyBenchCache(pModel);
+
+	// Least squares consequents
+	FuzzyBenchTrain(pModel);
+
+	// Batch (SIMD) evaluation of all the samples at once
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		pBatchInputs[i] = sgBenchBatchInputs[i];
+
+	start = clock();
+	for (pass = 0; pass < FUZZY_BENCH_PASS_NUM; ++pass)
+		FuzzyModelEvaluateBatch(pModel, pBatchInputs, sgBenchBatchOutputs, FUZZY_BENCH_SAMPLE_NUM);
+	FuzzyBenchReport(FuzzyBatchGetKernelName(), clock() - start, (double)FUZZY_BENCH_SAMPLE_NUM * FUZZY_BENCH_PASS_NUM);
+
+	// Lookup tables and memo, all clamped
+	if (pSurface)
+		FuzzyBenchTime("lookup table", FuzzyBenchEvalSurface, (void *)pSurface, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+	FuzzyBenchMemo(pModel, pSurface);
+	if (pOctree)
+		FuzzyBenchTime("octree", FuzzyBenchEvalOctree, (void *)pOctree, sgBenchInputs, FUZZY_BENCH_PASS_NUM);
+
+#ifdef FUZZY_STATS
+	FuzzyStatsMerge(&sgBenchStats);
+	AESysPrintf("  rule statistics: %.0f evaluations recorded\n", sgBenchStats.mTotal.mEvaluationNum);
+	FuzzyStatsAttach(0, 0);
+#endif
+}
@@ -0,0 +1,1455 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyBotGenerated.c
+Purpose:		Fuzzy model evaluation generated by FuzzyModelGenerate, do not edit
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+
+- End Header --------------------------------------------------------*/
+
+#include "FuzzyBotGenerated.h"
+
+// ---------------------------------------------------------------------------
+
+static __inline float FuzzyGenMin(float a, float b)
+{
+	return a < b ? a : b;
+}
+
+static __inline float FuzzyGenMu(float left, float right)
+{
+	float mu = left < right ? left : right;
+
+	return mu > 0.0f ? mu : 0.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+unsigned int FuzzyBotEvaluateHash(void)
+{
+	return 0x27D05A1Du;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyBotEvaluate(const float *pInputs, float *pOutputs)
+{
+	const float x0 = pInputs[0];
+	const float x1 = pInputs[1];
+	const float x2 = pInputs[2];
+	float mu0_0, mu0_1, mu0_2;
+	float mu1_0, mu1_1;
+	float mu2_0, mu2_1, mu2_2;
+	float f, w, den = 0.0f, num0 = 0.0f;
+	int s0, s1, s2;
+
+	if (x0 < 0.0f || x0 > 100.0f || x1 < 0.0f || x1 > 5.0f || x2 < 0.0f || x2 > 300.0f)
+	{
+		pOutputs[0] = 0.0f;
+		return;
+	}
+
+	s0 = 0 + (x0 >= 25.0f) + (x0 >= 50.0f) + (x0 >= 75.0f);
+	s1 = 0 + (x1 >= 1.5f) + (x1 >= 3.5f);
+	s2 = 0 + (x2 >= 100.0f) + (x2 >= 150.0f) + (x2 >= 200.0f) + (x2 >= 250.0f);
+
+	switch (s0 + s1 * 4 + s2 * 12)
+	{
+	case 0:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 1:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 2:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 3:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 4:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 5:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 6:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 7:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 8:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 9:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 10:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 11:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		break;
+	case 12:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 13:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 14:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 15:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 16:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 17:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 18:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 19:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 20:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 21:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 22:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 23:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 24:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 25:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 26:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 27:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 28:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 29:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 0
+		den += w;
+		num0 += w * (300.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 30:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 6
+		den += w;
+		num0 += w * (150.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 31:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 12
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 32:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 33:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 3
+		den += w;
+		num0 += w * (85.7142792f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 34:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 9
+		den += w;
+		num0 += w * (-189.285721f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 35:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_0 = FuzzyGenMu(x2 * 1.00000002e+30f + 1.0f, (200.0f - x2) * 0.00499999989f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_0);
+		// Rule 15
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + 0.75f * x2);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 36:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 37:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 38:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 39:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 40:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 41:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 1
+		den += w;
+		num0 += w * (0.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 42:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 7
+		den += w;
+		num0 += w * (-25.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 43:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 13
+		den += w;
+		num0 += w * (-300.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 44:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 45:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 4
+		den += w;
+		num0 += w * (-214.285721f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 46:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 10
+		den += w;
+		num0 += w * (-364.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 47:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_1 = FuzzyGenMu((x2 - 100.0f) * 0.0133333337f, (250.0f - x2) * 0.0133333337f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_1);
+		// Rule 16
+		den += w;
+		num0 += w * (-514.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 48:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 49:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 50:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 51:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 52:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 53:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 2
+		den += w;
+		num0 += w * (-125.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 54:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 8
+		den += w;
+		num0 += w * (-275.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 55:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_0 = FuzzyGenMu(x1 * 1.00000002e+30f + 1.0f, (3.5f - x1) * 0.285714298f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_0);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 14
+		den += w;
+		num0 += w * (-600.0f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 56:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 57:
+		mu0_0 = FuzzyGenMu(x0 * 1.00000002e+30f + 1.0f, (50.0f - x0) * 0.0199999996f);
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_0, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 5
+		den += w;
+		num0 += w * (-339.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 58:
+		mu0_1 = FuzzyGenMu((x0 - 25.0f) * 0.0399999991f, (75.0f - x0) * 0.0399999991f);
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_1, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 11
+		den += w;
+		num0 += w * (-664.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	case 59:
+		mu0_2 = FuzzyGenMu((x0 - 50.0f) * 0.0199999996f, (100.0f - x0) * 1.00000002e+30f + 1.0f);
+		mu1_1 = FuzzyGenMu((x1 - 1.5f) * 0.285714298f, (5.0f - x1) * 1.00000002e+30f + 1.0f);
+		mu2_2 = FuzzyGenMu((x2 - 150.0f) * 0.00666666683f, (300.0f - x2) * 1.00000002e+30f + 1.0f);
+		f = FuzzyGenMin(mu0_2, mu1_1);
+		w = FuzzyGenMin(f, mu2_2);
+		// Rule 17
+		den += w;
+		num0 += w * (-814.285706f + 3.0f * x0 + 42.8571434f * x1 + x2);
+		break;
+	}
+
+	if (den <= 0.0f)
+	{
+		pOutputs[0] = 0.0f;
+		return;
+	}
+
+	den = 1.0f / den;
+	pOutputs[0] = num0 * den;
+}
@@ -0,0 +1,95 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyCache.c
+Purpose:		Incremental re-evaluation of a fuzzy model from its last inputs
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "FuzzyCache.h"
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+
+void FuzzyCacheInit(FuzzyCache *pCache, const FuzzyModel *pModel, const float *pEpsilon)
+{
+	int i;
+
+	memset(pCache, 0, sizeof(FuzzyCache));
+	pCache->mpModel = pModel;
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+		pCache->mEpsilon[i] = pEpsilon ? pEpsilon[i] : 0.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyCacheInvalidate(FuzzyCache *pCache)
+{
+	pCache->mValid = 0;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyCacheSetMamdani(FuzzyCache *pCache, int mamdani)
+{
+	if (pCache->mMamdani != mamdani)
+	{
+		pCache->mMamdani = mamdani;
+		pCache->mValid = 0;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyCacheEvaluate(FuzzyCache *pCache, const float *pInputs, float *pOutputs)
+{
+	const FuzzyModel *pModel = pCache->mpModel;
+	int i, o, movedNum = 0;
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		float delta = pInputs[i] - pCache->mInputs[i];
+
+		// Equal inputs never count as moved, even with an epsilon of 0
+		if (!pCache->mValid || delta > pCache->mEpsilon[i] || -delta > pCache->mEpsilon[i])
+		{
+			pCache->mInputs[i] = pInputs[i];
+			FuzzyModelInputState(pModel, i, pInputs[i], pCache->mStates + i);
+			++movedNum;
+		}
+	}
+
+	if (!pCache->mValid)
+	{
+		++pCache->mMissNum;
+	}
+	else if (movedNum)
+	{
+		++pCache->mPartialNum;
+	}
+	else
+	{
+		++pCache->mHitNum;
+		for (o = 0; o < pModel->mOutputNum; ++o)
+			pOutputs[o] = pCache->mOutputs[o];
+		return;
+	}
+
+	pCache->mValid = 1;
+	if (pCache->mMamdani)
+		FuzzyModelEvaluateStatesMamdani(pModel, pCache->mStates, pCache->mOutputs);
+	else
+		FuzzyModelEvaluateStates(pModel, pCache->mStates, pCache->mInputs, pCache->mOutputs);
+
+	for (o = 0; o < pModel->mOutputNum; ++o)
+		pOutputs[o] = pCache->mOutputs[o];
+}
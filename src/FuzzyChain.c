@@ -0,0 +1,281 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyChain.c
+Purpose:		Hierarchical fuzzy systems: chains of small fuzzy systems evaluated in one pass
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "FuzzyChain.h"
+#include "FuzzyIO.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+
+#define FUZZY_CHAIN_LINE_LEN		256					// Longest line of a chain file
+#define FUZZY_CHAIN_DELIMITERS		" \t\r\n"
+
+// ---------------------------------------------------------------------------
+
+static char sgFuzzyChainError[256];
+
+// ---------------------------------------------------------------------------
+
+// Records the error message and returns 0, as FuzzyIOFail
+static int FuzzyChainFail(const char *pFormat, ...)
+{
+	va_list args;
+
+	va_start(args, pFormat);
+	vsnprintf(sgFuzzyChainError, sizeof(sgFuzzyChainError), pFormat, args);
+	va_end(args);
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------
+
+const char *FuzzyChainGetError(void)
+{
+	return sgFuzzyChainError;
+}
+
+// ---------------------------------------------------------------------------
+
+// Appends a value named pName, fails on a duplicate or when the chain is full
+static int FuzzyChainAddValue(FuzzyChain *pChain, const char *pName)
+{
+	if (strlen(pName) >= FUZZY_NAME_LEN)
+		return FuzzyChainFail("name \"%s\" is longer than %d characters", pName, FUZZY_NAME_LEN - 1);
+	if (FuzzyChainFind(pChain, pName) >= 0)
+		return FuzzyChainFail("\"%s\" is defined twice", pName);
+	if (pChain->mValueNum >= FUZZY_CHAIN_VALUE_NUM_MAX)
+		return FuzzyChainFail("more than %d values", FUZZY_CHAIN_VALUE_NUM_MAX);
+
+	strcpy(pChain->mValueName[pChain->mValueNum++], pName);
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyChainFind(const FuzzyChain *pChain, const char *pName)
+{
+	int v;
+
+	for (v = 0; v < pChain->mValueNum; ++v)
+	{
+		if (strcmp(pChain->mValueName[v], pName) == 0)
+			return v;
+	}
+
+	return -1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyChainInit(FuzzyChain *pChain, int inputNum, const char (*pNames)[FUZZY_NAME_LEN])
+{
+	int i;
+
+	memset(pChain, 0, sizeof(FuzzyChain));
+
+	if (inputNum > FUZZY_CHAIN_INPUT_NUM_MAX)
+		return FuzzyChainFail("more than %d inputs", FUZZY_CHAIN_INPUT_NUM_MAX);
+
+	for (i = 0; i < inputNum; ++i)
+	{
+		if (!FuzzyChainAddValue(pChain, pNames[i]))
+			return 0;
+	}
+	pChain->mInputNum = inputNum;
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyChainAddStage(FuzzyChain *pChain, const FuzzyRuleBase *pRuleBase)
+{
+	FuzzyChainStage *pStage;
+	int i, o, m;
+
+	if (pChain->mStageNum >= FUZZY_CHAIN_STAGE_NUM_MAX)
+		return FuzzyChainFail("more than %d stages", FUZZY_CHAIN_STAGE_NUM_MAX);
+
+	pStage = pChain->mStages + pChain->mStageNum;
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		int source = FuzzyChainFind(pChain, pRuleBase->mInputName[i]);
+
+		if (source < 0)
+			return FuzzyChainFail("stage %d: input \"%s\" is not an input of the chain or an output of an earlier stage",
+				pChain->mStageNum + 1, pRuleBase->mInputName[i]);
+		pStage->mSource[i] = (unsigned char)source;
+	}
+
+	pStage->mOutputStart = pChain->mValueNum;
+	for (o = 0; o < pRuleBase->mOutputNum; ++o)
+	{
+		if (!FuzzyChainAddValue(pChain, pRuleBase->mOutputName[o]))
+		{
+			pChain->mValueNum = pStage->mOutputStart;
+			return 0;
+		}
+
+		// Domain of the output: from the leftmost to the rightmost foot of its classes
+		pStage->mOutputMin[o] = pRuleBase->mOutputMf[o][0].a;
+		pStage->mOutputMax[o] = pRuleBase->mOutputMf[o][0].c;
+		for (m = 1; m < pRuleBase->mOutputMfNum[o]; ++m)
+		{
+			if (pRuleBase->mOutputMf[o][m].a < pStage->mOutputMin[o])
+				pStage->mOutputMin[o] = pRuleBase->mOutputMf[o][m].a;
+			if (pRuleBase->mOutputMf[o][m].c > pStage->mOutputMax[o])
+				pStage->mOutputMax[o] = pRuleBase->mOutputMf[o][m].c;
+		}
+	}
+
+	FuzzyModelCompile(&pStage->mModel, pRuleBase);
+	++pChain->mStageNum;
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyChainLoad(FuzzyChain *pChain, const char *pFileName)
+{
+	char line[FUZZY_CHAIN_LINE_LEN];
+	char names[FUZZY_CHAIN_INPUT_NUM_MAX][FUZZY_NAME_LEN];
+	int inputNum = 0, lineNum = 0, started = 0;
+	FILE *pFile = fopen(pFileName, "r");
+
+	memset(pChain, 0, sizeof(FuzzyChain));
+	if (pFile == 0)
+		return FuzzyChainFail("cannot open \"%s\"", pFileName);
+
+	while (fgets(line, sizeof(line), pFile))
+	{
+		char *pComment = strchr(line, '#');
+		char *pToken, *pArgument;
+
+		++lineNum;
+		if (pComment)
+			*pComment = 0;
+
+		pToken = strtok(line, FUZZY_CHAIN_DELIMITERS);
+		if (pToken == 0)
+			continue;
+
+		pArgument = strtok(0, FUZZY_CHAIN_DELIMITERS);
+		if (pArgument == 0)
+		{
+			fclose(pFile);
+			return FuzzyChainFail("%s line %d: missing argument", pFileName, lineNum);
+		}
+
+		if (strcmp(pToken, "input") == 0)
+		{
+			if (started || inputNum >= FUZZY_CHAIN_INPUT_NUM_MAX || strlen(pArgument) >= FUZZY_NAME_LEN)
+			{
+				fclose(pFile);
+				return FuzzyChainFail("%s line %d: %s", pFileName, lineNum, started ? "inputs must come before the stages" :
+					inputNum >= FUZZY_CHAIN_INPUT_NUM_MAX ? "too many inputs" : "name too long");
+			}
+			strcpy(names[inputNum++], pArgument);
+		}
+		else if (strcmp(pToken, "stage") == 0)
+		{
+			FuzzyRuleBase ruleBase;
+
+			if (!started && !FuzzyChainInit(pChain, inputNum, (const char (*)[FUZZY_NAME_LEN])names))
+			{
+				fclose(pFile);
+				return 0;
+			}
+			started = 1;
+
+			memset(&ruleBase, 0, sizeof(ruleBase));
+			if (!FuzzyRuleBaseLoad(&ruleBase, pArgument))
+			{
+				fclose(pFile);
+				return FuzzyChainFail("%s line %d: %s: %s", pFileName, lineNum, pArgument, FuzzyIOGetError());
+			}
+			if (!FuzzyChainAddStage(pChain, &ruleBase))
+			{
+				char error[sizeof(sgFuzzyChainError)];
+
+				fclose(pFile);
+				strcpy(error, sgFuzzyChainError);
+				return FuzzyChainFail("%s line %d: %s", pFileName, lineNum, error);
+			}
+		}
+		else
+		{
+			fclose(pFile);
+			return FuzzyChainFail("%s line %d: unknown statement \"%s\"", pFileName, lineNum, pToken);
+		}
+	}
+
+	fclose(pFile);
+
+	if (pChain->mStageNum == 0)
+		return FuzzyChainFail("%s: no stage", pFileName);
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyChainEvaluateValues(const FuzzyChain *pChain, const float *pInputs, float *pValues)
+{
+	int s, i, o;
+
+	memcpy(pValues, pInputs, pChain->mInputNum * sizeof(float));
+
+	for (s = 0; s < pChain->mStageNum; ++s)
+	{
+		const FuzzyChainStage *pStage = pChain->mStages + s;
+		const FuzzyModel *pModel = &pStage->mModel;
+		float inputs[FUZZY_INPUT_NUM_MAX];
+		float *pOutputs = pValues + pStage->mOutputStart;
+
+		for (i = 0; i < pModel->mInputNum; ++i)
+			inputs[i] = pValues[pStage->mSource[i]];
+
+		FuzzyModelEvaluateOutputs(pModel, inputs, pOutputs);
+
+		// The last stage's outputs are not fed to any stage
+		if (s == pChain->mStageNum - 1)
+			break;
+
+		for (o = 0; o < pModel->mOutputNum; ++o)
+		{
+			if (pOutputs[o] < pStage->mOutputMin[o])
+				pOutputs[o] = pStage->mOutputMin[o];
+			else if (pOutputs[o] > pStage->mOutputMax[o])
+				pOutputs[o] = pStage->mOutputMax[o];
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyChainEvaluate(const FuzzyChain *pChain, const float *pInputs)
+{
+	float values[FUZZY_CHAIN_VALUE_NUM_MAX];
+
+	FuzzyChainEvaluateValues(pChain, pInputs, values);
+
+	return values[pChain->mStages[pChain->mStageNum - 1].mOutputStart];
+}
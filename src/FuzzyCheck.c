@@ -0,0 +1,686 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyCheck.c
+Purpose:		Correctness checks of the fuzzy evaluators and bot queries
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "FuzzyCheck.h"
+#include "FuzzyBatch.h"
+#include "FuzzyBotGenerated.h"
+#include "FuzzyCache.h"
+#include "FuzzyFixed.h"
+#include "FuzzyMembership.h"
+#include "FuzzyMemo.h"
+#include "FuzzyOctree.h"
+#include "FuzzySurface.h"
+#include "BotPerception.h"
+#include "BotThreat.h"
+#include "BotInfluence.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// ---------------------------------------------------------------------------
+
+// Output of an evaluator for one input triple
+typedef float (*FuzzyCheckEval)(const void *pContext, const float *pInputs);
+
+static float sgCheckInputs[FUZZY_CHECK_SAMPLE_NUM][FUZZY_INPUT_NUM_MAX];
+static float sgCheckBatchInputs[FUZZY_INPUT_NUM_MAX][FUZZY_CHECK_SAMPLE_NUM];		// sgCheckInputs, one array per input
+static float sgCheckBatchOutputs[FUZZY_CHECK_SAMPLE_NUM];
+static FuzzyModel sgCheckModel;
+static FuzzyRuleBase sgCheckMultiRuleBase;
+static FuzzyModel sgCheckMultiModel;
+static FuzzyModel sgCheckOutputModels[FUZZY_OUTPUT_NUM_MAX];			// Output o of sgCheckMultiModel as the first and only output
+static FuzzyRuleBase sgCheckChainRuleBase;
+static FuzzyChain sgCheckChain;
+static FuzzyFixedModel sgCheckFixedModel;
+static BotPerception sgCheckPerception;
+static BotThreatGrid sgCheckThreatGrid, sgCheckThreatScan;
+static BotInfluence sgCheckInfluence, sgCheckInfluenceFull;
+static float sgCheckBotX[BOT_PERCEPTION_BOT_NUM_MAX], sgCheckBotY[BOT_PERCEPTION_BOT_NUM_MAX];
+static float sgCheckForwardX[BOT_PERCEPTION_BOT_NUM_MAX], sgCheckForwardY[BOT_PERCEPTION_BOT_NUM_MAX];
+static float sgCheckBulletX[FUZZY_CHECK_BULLET_NUM], sgCheckBulletY[FUZZY_CHECK_BULLET_NUM];
+static float sgCheckBulletVelocityX[FUZZY_CHECK_BULLET_NUM], sgCheckBulletVelocityY[FUZZY_CHECK_BULLET_NUM];
+static float sgCheckSamples[BOT_PERCEPTION_BOT_NUM_MAX];
+
+// ---------------------------------------------------------------------------
+
+static __inline float FuzzyCheckMax(float a, float b)
+{
+	return a > b ? a : b;
+}
+
+static __inline float FuzzyCheckClamp(float x, float lo, float hi)
+{
+	return x < lo ? lo : (x > hi ? hi : x);
+}
+
+// ---------------------------------------------------------------------------
+
+// Prints one check, returns 1 if it failed (a NaN fails)
+static int FuzzyCheckReport(FILE *pReport, const char *pName, float maxError, float bound)
+{
+	int failed = !(maxError <= bound);
+
+	fprintf(pReport, "  %-28s max error %-12g bound %-10g %s\n", pName, maxError, bound, failed ? "FAILED" : "passed");
+	return failed;
+}
+
+// Largest deviation of eval from reference on the random inputs
+static float FuzzyCheckDeviation(FuzzyCheckEval eval, const void *pContext, FuzzyCheckEval reference, const void *pReferenceContext)
+{
+	float maxError = 0.0f;
+	int s;
+
+	for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+		maxError = FuzzyCheckMax(maxError, fabsf(eval(pContext, sgCheckInputs[s]) - reference(pReferenceContext, sgCheckInputs[s])));
+
+	return maxError;
+}
+
+// ---------------------------------------------------------------------------
+
+static float FuzzyCheckEvalReference(const void *pContext, const float *pInputs)
+{
+	return FuzzyRuleBaseEvaluateReference((const FuzzyRuleBase *)pContext, pInputs, 0);
+}
+
+static float FuzzyCheckEvalAllRules(const void *pContext, const float *pInputs)
+{
+	return FuzzyModelEvaluate((const FuzzyModel *)pContext, pInputs);
+}
+
+static float FuzzyCheckEvalActiveRules(const void *pContext, const float *pInputs)
+{
+	return FuzzyModelEvaluateSparse((const FuzzyModel *)pContext, pInputs);
+}
+
+static float FuzzyCheckEvalGenerated(const void *pContext, const float *pInputs)
+{
+	float output;
+
+	(void)pContext;
+	FuzzyBotEvaluate(pInputs, &output);
+	return output;
+}
+
+static float FuzzyCheckEvalFixed(const void *pContext, const float *pInputs)
+{
+	FuzzyFixed inputs[FUZZY_INPUT_NUM_MAX], outputs[FUZZY_OUTPUT_NUM_MAX];
+	int i;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		inputs[i] = FuzzyFixedFromFloat(pInputs[i]);
+	FuzzyFixedModelEvaluate((const FuzzyFixedModel *)pContext, inputs, outputs);
+	return FuzzyFixedToFloat(outputs[0]);
+}
+
+static float FuzzyCheckEvalMamdani(const void *pContext, const float *pInputs)
+{
+	return FuzzyModelEvaluateMamdani((const FuzzyModel *)pContext, pInputs);
+}
+
+static float FuzzyCheckEvalMamdaniSampled(const void *pContext, const float *pInputs)
+{
+	return FuzzyCheckMamdaniSampled((const FuzzyRuleBase *)pContext, pInputs);
+}
+
+static float FuzzyCheckEvalChain(const void *pContext, const float *pInputs)
+{
+	return FuzzyChainEvaluate((const FuzzyChain *)pContext, pInputs);
+}
+
+// The stages of the chain one after the other, the first output clamped
+static float FuzzyCheckEvalStages(const void *pContext, const float *pInputs)
+{
+	const FuzzyChain *pChain = (const FuzzyChain *)pContext;
+	const FuzzyChainStage *pFirst = &pChain->mStages[0];
+	float inputs[FUZZY_INPUT_NUM_MAX];
+	int last = pFirst->mModel.mInputNum - 1;
+
+	memcpy(inputs, pInputs, sizeof(inputs));
+	inputs[last] = FuzzyCheckClamp(FuzzyModelEvaluate(&pFirst->mModel, pInputs), pFirst->mOutputMin[0], pFirst->mOutputMax[0]);
+	return FuzzyModelEvaluate(&pChain->mStages[1].mModel, inputs);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyCheckSample(float *pInputs)
+{
+	pInputs[0] = 100.0f * rand() / RAND_MAX;
+	pInputs[1] = (float)(rand() % 6);
+	pInputs[2] = 300.0f * rand() / RAND_MAX;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyCheckMatch(float (*pInputs)[FUZZY_INPUT_NUM_MAX], int num)
+{
+	float y = 150.0f;
+	int s;
+
+	for (s = 0; s < num; ++s)
+	{
+		if ((s >> 4) & 1)
+			y = 150.0f + 140.0f * sinf(s * 0.01f);
+		pInputs[s][0] = 100.0f - 10.0f * (s / 512);
+		pInputs[s][1] = (float)(5 - (s / 64) % 6);
+		pInputs[s][2] = y;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyCheckScatter(float *pX, float *pY, float *pVelocityX, float *pVelocityY, int num, float speed)
+{
+	int p;
+
+	for (p = 0; p < num; ++p)
+	{
+		pX[p] = 800.0f * rand() / RAND_MAX - 400.0f;
+		pY[p] = 600.0f * rand() / RAND_MAX - 300.0f;
+
+		if (pVelocityX)
+		{
+			float angle = 6.2831853f * rand() / RAND_MAX;
+
+			pVelocityX[p] = speed * cosf(angle);
+			pVelocityY[p] = speed * sinf(angle);
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyCheckMultiOutput(FuzzyRuleBase *pMulti, const FuzzyRuleBase *pRuleBase)
+{
+	int o, r;
+
+	*pMulti = *pRuleBase;
+	pMulti->mOutputNum = FUZZY_OUTPUT_NUM_MAX;
+	for (o = 1; o < FUZZY_OUTPUT_NUM_MAX; ++o)
+	{
+		pMulti->mOutputMfNum[o] = pRuleBase->mOutputMfNum[0];
+		memcpy(pMulti->mOutputMf[o], pRuleBase->mOutputMf[0], sizeof(pRuleBase->mOutputMf[0]));
+		for (r = 0; r < pRuleBase->mRuleNum; ++r)
+			pMulti->mRuleOutput[r][o] = (pRuleBase->mRuleOutput[r][0] + o) % pRuleBase->mOutputMfNum[0];
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyCheckChain(FuzzyChain *pChain, FuzzyRuleBase *pSecond, const FuzzyRuleBase *pRuleBase)
+{
+	char names[FUZZY_INPUT_NUM_MAX][FUZZY_NAME_LEN];
+	int i;
+
+	*pSecond = *pRuleBase;
+	strcpy(pSecond->mInputName[pRuleBase->mInputNum - 1], pRuleBase->mOutputName[0]);
+	strcpy(pSecond->mOutputName[0], "OUT");
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+		strcpy(names[i], pRuleBase->mInputName[i]);
+
+	return FuzzyChainInit(pChain, pRuleBase->mInputNum, (const char (*)[FUZZY_NAME_LEN])names) &&
+		FuzzyChainAddStage(pChain, pRuleBase) && FuzzyChainAddStage(pChain, pSecond);
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyCheckMamdaniSampled(const FuzzyRuleBase *pRuleBase, const float *pInputs)
+{
+	float height[FUZZY_MF_NUM_MAX];
+	float lo, hi, step, area = 0.0f, moment = 0.0f;
+	int i, m, r, k;
+
+	memset(height, 0, sizeof(height));
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+	{
+		float firing = 1.0f;
+
+		for (i = 0; i < pRuleBase->mInputNum; ++i)
+			firing = fminf(firing, FuzzyTriangleEvaluate(&pRuleBase->mInputMf[i][pRuleBase->mRuleMf[r][i]], pInputs[i]));
+		m = pRuleBase->mRuleOutput[r][0];
+		height[m] = FuzzyCheckMax(height[m], firing);
+	}
+
+	lo = pRuleBase->mOutputMf[0][0].a;
+	hi = pRuleBase->mOutputMf[0][0].c;
+	for (m = 1; m < pRuleBase->mOutputMfNum[0]; ++m)
+	{
+		lo = fminf(lo, pRuleBase->mOutputMf[0][m].a);
+		hi = FuzzyCheckMax(hi, pRuleBase->mOutputMf[0][m].c);
+	}
+
+	// Midpoint rule
+	step = (hi - lo) / FUZZY_CHECK_MAMDANI_STEP_NUM;
+	for (k = 0; k < FUZZY_CHECK_MAMDANI_STEP_NUM; ++k)
+	{
+		float x = lo + (k + 0.5f) * step, mu = 0.0f;
+
+		for (m = 0; m < pRuleBase->mOutputMfNum[0]; ++m)
+			mu += fminf(height[m], FuzzyTriangleEvaluate(&pRuleBase->mOutputMf[0][m], x));
+		area += mu;
+		moment += mu * x;
+	}
+
+	return area > 0.0f ? moment / area : 0.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+// The membership sets against Triangle(), every function of every input
+static int FuzzyCheckMemberships(const FuzzyRuleBase *pRuleBase, FILE *pReport)
+{
+	FuzzyMfSet set;
+	float mu[FUZZY_MF_NUM_MAX], maxError = 0.0f;
+	int s, i, m;
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		FuzzyMfSetCompileTriangles(&set, pRuleBase->mInputMf[i], pRuleBase->mMfNum[i]);
+		for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+		{
+			FuzzyMfSetEvaluate(&set, sgCheckInputs[s][i], mu);
+			for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+				maxError = FuzzyCheckMax(maxError, fabsf(mu[m] - FuzzyTriangleEvaluate(&pRuleBase->mInputMf[i][m], sgCheckInputs[s][i])));
+		}
+	}
+
+	return FuzzyCheckReport(pReport, "memberships (set)", maxError, FUZZY_CHECK_TOLERANCE);
+}
+
+// Every output of a model with FUZZY_OUTPUT_NUM_MAX outputs against the reference
+static int FuzzyCheckOutputs(const FuzzyRuleBase *pRuleBase, FILE *pReport)
+{
+	float outputs[FUZZY_OUTPUT_NUM_MAX], maxError = 0.0f;
+	int s, o;
+
+	FuzzyCheckMultiOutput(&sgCheckMultiRuleBase, pRuleBase);
+	FuzzyModelCompile(&sgCheckMultiModel, &sgCheckMultiRuleBase);
+
+	for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+	{
+		FuzzyModelEvaluateOutputs(&sgCheckMultiModel, sgCheckInputs[s], outputs);
+		for (o = 0; o < FUZZY_OUTPUT_NUM_MAX; ++o)
+			maxError = FuzzyCheckMax(maxError, fabsf(outputs[o] - FuzzyRuleBaseEvaluateReference(&sgCheckMultiRuleBase, sgCheckInputs[s], o)));
+	}
+
+	return FuzzyCheckReport(pReport, "compiled (all outputs)", maxError, FUZZY_CHECK_TOLERANCE);
+}
+
+// The batch kernel against the model, both clamped to [outMin, outMax] as
+// getFuzzyOutputY does. 3 samples short of whole vectors, so that the
+// bots left to the scalar loop are checked too
+static int FuzzyCheckBatch(float outMin, float outMax, FILE *pReport)
+{
+	const float *pInputs[FUZZY_INPUT_NUM_MAX];
+	const int num = FUZZY_CHECK_SAMPLE_NUM - 3;
+	float maxError = 0.0f;
+	int s, i;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		for (s = 0; s < num; ++s)
+			sgCheckBatchInputs[i][s] = sgCheckInputs[s][i];
+		pInputs[i] = sgCheckBatchInputs[i];
+	}
+	FuzzyModelEvaluateBatch(&sgCheckModel, pInputs, sgCheckBatchOutputs, num);
+
+	for (s = 0; s < num; ++s)
+		maxError = FuzzyCheckMax(maxError, fabsf(FuzzyCheckClamp(sgCheckBatchOutputs[s], outMin, outMax) -
+			FuzzyCheckClamp(FuzzyModelEvaluateSparse(&sgCheckModel, sgCheckInputs[s]), outMin, outMax)));
+
+	return FuzzyCheckReport(pReport, "batch (clamped)", maxError, FUZZY_CHECK_TOLERANCE);
+}
+
+// The cached outputs of a simulated match against the model on the inputs they were cached for
+static int FuzzyCheckCache(FILE *pReport)
+{
+	float epsilon[FUZZY_INPUT_NUM_MAX] = { 0.0f, 0.0f, 0.5f };
+	float outputs[FUZZY_OUTPUT_NUM_MAX], exact[FUZZY_OUTPUT_NUM_MAX], maxError = 0.0f;
+	FuzzyCache cache;
+	int s, o;
+
+	FuzzyCheckMatch(sgCheckInputs, FUZZY_CHECK_SAMPLE_NUM);
+	FuzzyCacheInit(&cache, &sgCheckModel, epsilon);
+	for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+	{
+		FuzzyCacheEvaluate(&cache, sgCheckInputs[s], outputs);
+		FuzzyModelEvaluateOutputs(&sgCheckModel, cache.mInputs, exact);
+		for (o = 0; o < sgCheckModel.mOutputNum; ++o)
+			maxError = FuzzyCheckMax(maxError, fabsf(outputs[o] - exact[o]));
+	}
+
+	return FuzzyCheckReport(pReport, "incremental", maxError, FUZZY_CHECK_TOLERANCE);
+}
+
+// Same, with every output of the multi output model and the Mamdani
+// centroids turned on and off every 4096 frames, against the closed form
+static int FuzzyCheckCacheMamdani(FILE *pReport)
+{
+	float epsilon[FUZZY_INPUT_NUM_MAX] = { 0.0f, 0.0f, 0.5f };
+	float outputs[FUZZY_OUTPUT_NUM_MAX], exact[FUZZY_OUTPUT_NUM_MAX], maxError = 0.0f;
+	FuzzyRuleBase single;
+	FuzzyCache cache;
+	int s, o, r;
+
+	for (o = 0; o < FUZZY_OUTPUT_NUM_MAX; ++o)
+	{
+		single = sgCheckMultiRuleBase;
+		single.mOutputNum = 1;
+		for (r = 0; r < single.mRuleNum; ++r)
+			single.mRuleOutput[r][0] = sgCheckMultiRuleBase.mRuleOutput[r][o];
+		FuzzyModelCompile(&sgCheckOutputModels[o], &single);
+	}
+
+	FuzzyCacheInit(&cache, &sgCheckMultiModel, epsilon);
+	for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+	{
+		FuzzyCacheSetMamdani(&cache, (s >> 12) & 1);
+		FuzzyCacheEvaluate(&cache, sgCheckInputs[s], outputs);
+		if (cache.mMamdani)
+		{
+			for (o = 0; o < FUZZY_OUTPUT_NUM_MAX; ++o)
+				exact[o] = FuzzyModelEvaluateMamdani(&sgCheckOutputModels[o], cache.mInputs);
+		}
+		else
+		{
+			FuzzyModelEvaluateOutputs(&sgCheckMultiModel, cache.mInputs, exact);
+		}
+		for (o = 0; o < FUZZY_OUTPUT_NUM_MAX; ++o)
+			maxError = FuzzyCheckMax(maxError, fabsf(outputs[o] - exact[o]));
+	}
+
+	return FuzzyCheckReport(pReport, "incremental (mamdani)", maxError, FUZZY_CHECK_TOLERANCE);
+}
+
+// The memo against the clamped model on the inputs rounded to its steps
+static int FuzzyCheckMemo(float outMin, float outMax, FILE *pReport)
+{
+	float step[FUZZY_INPUT_NUM_MAX] = { 1.0f, 1.0f, 2.0f };
+	float rounded[FUZZY_INPUT_NUM_MAX], maxError = 0.0f;
+	FuzzyMemo memo;
+	int s, i, pass;
+
+	memset(&memo, 0, sizeof(FuzzyMemo));
+	if (!FuzzyMemoInit(&memo, &sgCheckModel, step, outMin, outMax, 4096, 1))
+		return FuzzyCheckReport(pReport, "memo (out of memory)", 0.0f, -1.0f);
+
+	// The second pass reads what the first one stored
+	for (pass = 0; pass < 2; ++pass)
+		for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+		{
+			for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+				rounded[i] = floorf(sgCheckInputs[s][i] / step[i] + 0.5f) * step[i];
+			maxError = FuzzyCheckMax(maxError, fabsf(FuzzyMemoEvaluate(&memo, 0, sgCheckInputs[s]) -
+				FuzzyCheckClamp(FuzzyModelEvaluateSparse(&sgCheckModel, rounded), outMin, outMax)));
+		}
+	FuzzyMemoFree(&memo);
+
+	return FuzzyCheckReport(pReport, "memo", maxError, FUZZY_CHECK_TOLERANCE);
+}
+
+// The lookup table within FUZZY_CHECK_ERROR_MAX against its error bound
+static int FuzzyCheckSurface(float outMin, float outMax, FILE *pReport)
+{
+	float min[FUZZY_INPUT_NUM_MAX] = { 0.0f, 0.0f, 0.0f }, max[FUZZY_INPUT_NUM_MAX] = { 100.0f, 5.0f, 300.0f };
+	int resolution[FUZZY_INPUT_NUM_MAX] = { 5, 6, 7 };
+	FuzzySurface surface;
+	float maxError = 0.0f;
+	int s, failed;
+
+	memset(&surface, 0, sizeof(FuzzySurface));
+	FuzzySurfaceBuildForError(&surface, &sgCheckModel, min, max, resolution, outMin, outMax, 1u << 1,
+		FUZZY_CHECK_RESOLUTION_MAX, FUZZY_CHECK_ERROR_MAX);
+	if (surface.mpSamples == 0)
+		return FuzzyCheckReport(pReport, "lookup table (out of memory)", 0.0f, -1.0f);
+
+	for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+		maxError = FuzzyCheckMax(maxError, fabsf(FuzzySurfaceEvaluate(&surface, sgCheckInputs[s]) -
+			FuzzyCheckClamp(FuzzyModelEvaluate(&sgCheckModel, sgCheckInputs[s]), outMin, outMax)));
+	failed = FuzzyCheckReport(pReport, "lookup table (error bound)", maxError, surface.mMaxError);
+	FuzzySurfaceFree(&surface);
+
+	return failed;
+}
+
+// The octree within FUZZY_CHECK_ERROR_MAX against the error it reports
+static int FuzzyCheckOctree(float outMin, float outMax, FILE *pReport)
+{
+	float min[FUZZY_INPUT_NUM_MAX] = { 0.0f, 0.0f, 0.0f }, max[FUZZY_INPUT_NUM_MAX] = { 100.0f, 5.0f, 300.0f };
+	FuzzyOctree tree;
+	float maxError = 0.0f;
+	int s, failed;
+
+	memset(&tree, 0, sizeof(FuzzyOctree));
+	if (!FuzzyOctreeBuild(&tree, &sgCheckModel, min, max, outMin, outMax, 1u << 1, FUZZY_CHECK_ERROR_MAX, FUZZY_CHECK_DEPTH_MAX))
+		return FuzzyCheckReport(pReport, "octree (out of memory)", 0.0f, -1.0f);
+
+	for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+		maxError = FuzzyCheckMax(maxError, fabsf(FuzzyOctreeEvaluate(&tree, sgCheckInputs[s]) -
+			FuzzyCheckClamp(FuzzyModelEvaluate(&sgCheckModel, sgCheckInputs[s]), outMin, outMax)));
+	failed = FuzzyCheckReport(pReport, "octree (reported error)", maxError, tree.mpHeader->mMaxError);
+	FuzzyOctreeFree(&tree);
+
+	return failed;
+}
+
+// The batched lateral offsets against double precision. Every 4th bot has
+// the first target straight ahead, the next one straight behind, where the
+// angle of the original FindPlayer lost the most precision
+static int FuzzyCheckPerception(FILE *pReport)
+{
+	float targetX[BOT_PERCEPTION_TARGET_NUM_MAX], targetY[BOT_PERCEPTION_TARGET_NUM_MAX];
+	FuzzyFixed forward[2], offset[2];
+	float maxError = 0.0f, maxFixedError = 0.0f;
+	int b, t, failed;
+
+	FuzzyCheckScatter(targetX, targetY, 0, 0, BOT_PERCEPTION_TARGET_NUM_MAX, 0.0f);
+	FuzzyCheckScatter(sgCheckBotX, sgCheckBotY, sgCheckForwardX, sgCheckForwardY, BOT_PERCEPTION_BOT_NUM_MAX, 1.0f);
+	for (b = 0; b < BOT_PERCEPTION_BOT_NUM_MAX; b += 4)
+	{
+		float range = 50.0f + 300.0f * rand() / RAND_MAX;
+
+		sgCheckBotX[b] = targetX[0] - range * sgCheckForwardX[b];
+		sgCheckBotY[b] = targetY[0] - range * sgCheckForwardY[b];
+		sgCheckBotX[b + 1] = targetX[0] + range * sgCheckForwardX[b + 1];
+		sgCheckBotY[b + 1] = targetY[0] + range * sgCheckForwardY[b + 1];
+	}
+
+	BotPerceptionUpdate(&sgCheckPerception, sgCheckBotX, sgCheckBotY, sgCheckForwardX, sgCheckForwardY, BOT_PERCEPTION_BOT_NUM_MAX,
+		targetX, targetY, BOT_PERCEPTION_TARGET_NUM_MAX);
+
+	for (t = 0; t < BOT_PERCEPTION_TARGET_NUM_MAX; ++t)
+		for (b = 0; b < BOT_PERCEPTION_BOT_NUM_MAX; ++b)
+		{
+			float offsetX = targetX[t] - sgCheckBotX[b], offsetY = targetY[t] - sgCheckBotY[b];
+			double cross = (double)sgCheckForwardX[b] * offsetY - (double)sgCheckForwardY[b] * offsetX;
+			float exact = (float)(cross / sqrt((double)sgCheckForwardX[b] * sgCheckForwardX[b] + (double)sgCheckForwardY[b] * sgCheckForwardY[b]));
+
+			maxError = FuzzyCheckMax(maxError, fabsf(sgCheckPerception.mLateral[t][b] - exact));
+
+			forward[0] = FuzzyFixedFromFloat(sgCheckForwardX[b]);
+			forward[1] = FuzzyFixedFromFloat(sgCheckForwardY[b]);
+			offset[0] = FuzzyFixedFromFloat(offsetX);
+			offset[1] = FuzzyFixedFromFloat(offsetY);
+			maxFixedError = FuzzyCheckMax(maxFixedError, fabsf(FuzzyFixedToFloat(FuzzyFixedLateral(forward, offset)) - exact));
+		}
+
+	failed = FuzzyCheckReport(pReport, "perception (batched)", maxError, FUZZY_CHECK_TOLERANCE);
+	failed += FuzzyCheckReport(pReport, "fixed point (lateral)", maxFixedError, FUZZY_CHECK_FIXED_TOLERANCE);
+
+	return failed;
+}
+
+// The threat grid against a grid of one cell, i.e. every bullet tested by
+// every bot: the same bullets must be counted at the same times to impact
+static int FuzzyCheckThreat(FILE *pReport)
+{
+	BotThreat threat, reference;
+	float maxError = 0.0f;
+	int b, mismatchNum = 0, failed;
+
+	FuzzyCheckScatter(sgCheckBulletX, sgCheckBulletY, sgCheckBulletVelocityX, sgCheckBulletVelocityY, FUZZY_CHECK_BULLET_NUM, 700.0f);
+	FuzzyCheckScatter(sgCheckBotX, sgCheckBotY, 0, 0, BOT_PERCEPTION_BOT_NUM_MAX, 0.0f);
+	BotThreatGridInit(&sgCheckThreatGrid, 64.0f, 40.0f, 0.5f);
+	BotThreatGridInit(&sgCheckThreatScan, 1000.0f, 40.0f, 0.5f);
+	BotThreatGridBuild(&sgCheckThreatGrid, -400.0f, -300.0f, 400.0f, 300.0f, sgCheckBulletX, sgCheckBulletY,
+		sgCheckBulletVelocityX, sgCheckBulletVelocityY, FUZZY_CHECK_BULLET_NUM);
+	BotThreatGridBuild(&sgCheckThreatScan, -400.0f, -300.0f, 400.0f, 300.0f, sgCheckBulletX, sgCheckBulletY,
+		sgCheckBulletVelocityX, sgCheckBulletVelocityY, FUZZY_CHECK_BULLET_NUM);
+
+	for (b = 0; b < BOT_PERCEPTION_BOT_NUM_MAX; ++b)
+	{
+		BotThreatQuery(&sgCheckThreatGrid, sgCheckBotX[b], sgCheckBotY[b], &threat);
+		BotThreatQuery(&sgCheckThreatScan, sgCheckBotX[b], sgCheckBotY[b], &reference);
+		maxError = FuzzyCheckMax(maxError, fabsf(threat.mTime - reference.mTime));
+		mismatchNum += threat.mBulletNum != reference.mBulletNum;
+	}
+
+	failed = FuzzyCheckReport(pReport, "threat (time to impact)", maxError, 0.0f);
+	failed += FuzzyCheckReport(pReport, "threat (bots miscounted)", (float)mismatchNum, 0.0f);
+
+	return failed;
+}
+
+// The batched influence samples against BotInfluenceSample, after a few
+// frames of bullets and a line of fire stamped, and the update of the live
+// tiles against an update of every tile, until the map has faded out
+static int FuzzyCheckInfluence(FILE *pReport)
+{
+	float maxError = 0.0f, maxTileError = 0.0f;
+	int b, k, c, frame, failed;
+
+	FuzzyCheckScatter(sgCheckBulletX, sgCheckBulletY, sgCheckBulletVelocityX, sgCheckBulletVelocityY, FUZZY_CHECK_BULLET_NUM, 700.0f);
+	FuzzyCheckScatter(sgCheckBotX, sgCheckBotY, 0, 0, BOT_PERCEPTION_BOT_NUM_MAX, 0.0f);
+	BotInfluenceInit(&sgCheckInfluence, -400.0f, -300.0f, 400.0f, 300.0f, 25.0f, 0.9f, 0.7f);
+	sgCheckInfluenceFull = sgCheckInfluence;
+
+	// A few bullets for 16 frames, the player's column for 64, then the map
+	// fades out. The second map updates every tile, as if all were live
+	for (frame = 0; frame < 160; ++frame)
+	{
+		float shipX = 10.0f * frame - 320.0f;
+
+		memset(sgCheckInfluenceFull.mLive, 1, sizeof(sgCheckInfluenceFull.mLive));
+		BotInfluenceUpdate(&sgCheckInfluence);
+		BotInfluenceUpdate(&sgCheckInfluenceFull);
+		for (b = 0; b < FUZZY_CHECK_BULLET_NUM / 16 && frame < 16; ++b)
+		{
+			float x = sgCheckBulletX[b] + sgCheckBulletVelocityX[b] * frame / 60.0f;
+			float y = sgCheckBulletY[b] + sgCheckBulletVelocityY[b] * frame / 60.0f;
+
+			BotInfluenceStamp(&sgCheckInfluence, BOT_INFLUENCE_DANGER, x - sgCheckBulletVelocityX[b] / 60.0f,
+				y - sgCheckBulletVelocityY[b] / 60.0f, x, y, 40.0f, 1.0f);
+			BotInfluenceStamp(&sgCheckInfluenceFull, BOT_INFLUENCE_DANGER, x - sgCheckBulletVelocityX[b] / 60.0f,
+				y - sgCheckBulletVelocityY[b] / 60.0f, x, y, 40.0f, 1.0f);
+		}
+		if (frame < 64)
+		{
+			BotInfluenceStamp(&sgCheckInfluence, BOT_INFLUENCE_OPPORTUNITY, shipX, -270.0f, shipX, 300.0f, 60.0f, 1.0f);
+			BotInfluenceStamp(&sgCheckInfluenceFull, BOT_INFLUENCE_OPPORTUNITY, shipX, -270.0f, shipX, 300.0f, 60.0f, 1.0f);
+		}
+
+		for (k = 0; k < BOT_INFLUENCE_NUM; ++k)
+			for (c = 0; c < BOT_INFLUENCE_CELL_NUM_MAX; ++c)
+				maxTileError = FuzzyCheckMax(maxTileError, fabsf(sgCheckInfluence.mCells[sgCheckInfluence.mCurrent][k][c] -
+					sgCheckInfluenceFull.mCells[sgCheckInfluenceFull.mCurrent][k][c]));
+
+		// The batched samples while both layers are busy
+		for (k = 0; k < BOT_INFLUENCE_NUM && frame == 15; ++k)
+		{
+			BotInfluenceSampleBatch(&sgCheckInfluence, k, sgCheckBotX, sgCheckBotY, BOT_PERCEPTION_BOT_NUM_MAX, sgCheckSamples);
+			for (b = 0; b < BOT_PERCEPTION_BOT_NUM_MAX; ++b)
+				maxError = FuzzyCheckMax(maxError, fabsf(sgCheckSamples[b] - BotInfluenceSample(&sgCheckInfluence, k, sgCheckBotX[b], sgCheckBotY[b])));
+		}
+	}
+
+	failed = FuzzyCheckReport(pReport, "influence (batch)", maxError, 0.0f);
+	return failed + FuzzyCheckReport(pReport, "influence (live tiles)", maxTileError, 0.0f);
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyCheckRun(const FuzzyRuleBase *pRuleBase, float outMin, float outMax, FILE *pReport)
+{
+	float outputMin, outputMax;
+	int s, m, failedNum = 0;
+
+	srand(562);
+	for (s = 0; s < FUZZY_CHECK_SAMPLE_NUM; ++s)
+		FuzzyCheckSample(sgCheckInputs[s]);
+	FuzzyModelCompile(&sgCheckModel, pRuleBase);
+
+	fprintf(pReport, "Fuzzy checks: %d rules, %d random inputs, %s batch kernel\n", pRuleBase->mRuleNum, FUZZY_CHECK_SAMPLE_NUM, FuzzyBatchGetKernelName());
+
+	failedNum += FuzzyCheckMemberships(pRuleBase, pReport);
+	failedNum += FuzzyCheckReport(pReport, "compiled (all rules)",
+		FuzzyCheckDeviation(FuzzyCheckEvalAllRules, &sgCheckModel, FuzzyCheckEvalReference, pRuleBase), FUZZY_CHECK_TOLERANCE);
+	failedNum += FuzzyCheckReport(pReport, "compiled (active rules)",
+		FuzzyCheckDeviation(FuzzyCheckEvalActiveRules, &sgCheckModel, FuzzyCheckEvalReference, pRuleBase), FUZZY_CHECK_TOLERANCE);
+	failedNum += FuzzyCheckOutputs(pRuleBase, pReport);
+	failedNum += FuzzyCheckBatch(outMin, outMax, pReport);
+
+	// The generated evaluator is only checked if it was generated from these rules
+	if (FuzzyBotEvaluateHash() == FuzzyModelHash(&sgCheckModel))
+	{
+		failedNum += FuzzyCheckReport(pReport, "generated (unrolled)",
+			FuzzyCheckDeviation(FuzzyCheckEvalGenerated, 0, FuzzyCheckEvalReference, pRuleBase), FUZZY_CHECK_TOLERANCE);
+	}
+	else
+	{
+		fprintf(pReport, "  generated (unrolled)         built from other rules, skipped\n");
+	}
+
+	FuzzyFixedModelCompile(&sgCheckFixedModel, &sgCheckModel);
+	failedNum += FuzzyCheckReport(pReport, "fixed point",
+		FuzzyCheckDeviation(FuzzyCheckEvalFixed, &sgCheckFixedModel, FuzzyCheckEvalActiveRules, &sgCheckModel), FUZZY_CHECK_FIXED_TOLERANCE);
+
+	// The closed form against the midpoint rule, within one sampling step
+	outputMin = pRuleBase->mOutputMf[0][0].a;
+	outputMax = pRuleBase->mOutputMf[0][0].c;
+	for (m = 1; m < pRuleBase->mOutputMfNum[0]; ++m)
+	{
+		outputMin = fminf(outputMin, pRuleBase->mOutputMf[0][m].a);
+		outputMax = FuzzyCheckMax(outputMax, pRuleBase->mOutputMf[0][m].c);
+	}
+	failedNum += FuzzyCheckReport(pReport, "mamdani (closed form)",
+		FuzzyCheckDeviation(FuzzyCheckEvalMamdani, &sgCheckModel, FuzzyCheckEvalMamdaniSampled, pRuleBase),
+		(outputMax - outputMin) / FUZZY_CHECK_MAMDANI_STEP_NUM);
+
+	if (FuzzyCheckChain(&sgCheckChain, &sgCheckChainRuleBase, pRuleBase))
+	{
+		failedNum += FuzzyCheckReport(pReport, "chain (2 stages)",
+			FuzzyCheckDeviation(FuzzyCheckEvalChain, &sgCheckChain, FuzzyCheckEvalStages, &sgCheckChain), FUZZY_CHECK_TOLERANCE);
+	}
+	else
+	{
+		failedNum += FuzzyCheckReport(pReport, FuzzyChainGetError(), 0.0f, -1.0f);
+	}
+
+	failedNum += FuzzyCheckMemo(outMin, outMax, pReport);
+	failedNum += FuzzyCheckSurface(outMin, outMax, pReport);
+	failedNum += FuzzyCheckOctree(outMin, outMax, pReport);
+	failedNum += FuzzyCheckPerception(pReport);
+	failedNum += FuzzyCheckThreat(pReport);
+	failedNum += FuzzyCheckInfluence(pReport);
+
+	// Last, it replaces the random inputs by the frames of a match
+	failedNum += FuzzyCheckCache(pReport);
+	failedNum += FuzzyCheckCacheMamdani(pReport);
+
+	fprintf(pReport, "%d checks failed\n", failedNum);
+	return failedNum;
+}
@@ -0,0 +1,292 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyCodegen.c
+Purpose:		Generation of C code evaluating a compiled fuzzy model
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "FuzzyCodegen.h"
+#include <stdio.h>
+#include <string.h>
+
+#define FUZZY_CODEGEN_FLOAT_LEN		32					// Longest float literal written
+
+// ---------------------------------------------------------------------------
+
+// Writes value as a float literal that reads back exactly ("0.5f", "1e+30f", "2.0f")
+static const char *FuzzyCodegenFloat(char *pText, float value)
+{
+	sprintf(pText, "%.9g", value);
+	if (strpbrk(pText, ".e") == 0)
+	{
+		strcat(pText, ".0");
+	}
+	strcat(pText, "f");
+
+	return pText;
+}
+
+// ---------------------------------------------------------------------------
+
+// Writes " + k * x<i>" (or " - |k| * x<i>"), nothing for k = 0
+static void FuzzyCodegenTerm(FILE *pFile, float k, int i)
+{
+	char text[FUZZY_CODEGEN_FLOAT_LEN];
+
+	if (k == 0.0f)
+	{
+		return;
+	}
+	if (k == 1.0f || k == -1.0f)
+	{
+		fprintf(pFile, " %c x%d", k > 0.0f ? '+' : '-', i);
+		return;
+	}
+	fprintf(pFile, " %c %s * x%d", k > 0.0f ? '+' : '-', FuzzyCodegenFloat(text, k > 0.0f ? k : -k), i);
+}
+
+// ---------------------------------------------------------------------------
+
+// Writes "mu<i>_<m> = ...;", the ramps of FuzzyModel with the zero foots and biases left out
+static void FuzzyCodegenMembership(FILE *pFile, const FuzzyModel *pModel, int i, int m)
+{
+	char a[FUZZY_CODEGEN_FLOAT_LEN], c[FUZZY_CODEGEN_FLOAT_LEN], inv[FUZZY_CODEGEN_FLOAT_LEN], bias[FUZZY_CODEGEN_FLOAT_LEN];
+
+	fprintf(pFile, "\t\tmu%d_%d = FuzzyGenMu(", i, m);
+
+	if (pModel->mMfA[i][m] == 0.0f)
+		fprintf(pFile, "x%d * %s", i, FuzzyCodegenFloat(inv, pModel->mMfInvL[i][m]));
+	else
+		fprintf(pFile, "(x%d - %s) * %s", i, FuzzyCodegenFloat(a, pModel->mMfA[i][m]), FuzzyCodegenFloat(inv, pModel->mMfInvL[i][m]));
+	if (pModel->mMfBiasL[i][m] != 0.0f)
+		fprintf(pFile, " + %s", FuzzyCodegenFloat(bias, pModel->mMfBiasL[i][m]));
+
+	fprintf(pFile, ", (%s - x%d) * %s", FuzzyCodegenFloat(c, pModel->mMfC[i][m]), i, FuzzyCodegenFloat(inv, pModel->mMfInvR[i][m]));
+	if (pModel->mMfBiasR[i][m] != 0.0f)
+		fprintf(pFile, " + %s", FuzzyCodegenFloat(bias, pModel->mMfBiasR[i][m]));
+
+	fprintf(pFile, ");\n");
+}
+
+// ---------------------------------------------------------------------------
+
+// Writes the rules that can fire when every input i is in segment pSegment[i],
+// as FuzzyModelFireStates visits them: every combination of the segments'
+// membership functions, the rules of its cell sharing its firing strength
+static void FuzzyCodegenCase(FILE *pFile, const FuzzyModel *pModel, const int *pSegment)
+{
+	unsigned char needed[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	int pos[FUZZY_INPUT_NUM_MAX];
+	char text[FUZZY_CODEGEN_FLOAT_LEN];
+	int i, j, o, r, pass, cell, pair = -1;
+
+	// Pass 0 finds the memberships some rule needs, pass 1 writes the rules
+	memset(needed, 0, sizeof(needed));
+	for (pass = 0; pass < 2; ++pass)
+	{
+		if (pass == 1)
+		{
+			for (i = 0; i < pModel->mInputNum; ++i)
+				for (j = 0; j < pModel->mSegMfNum[i][pSegment[i]]; ++j)
+					if (needed[i][pModel->mSegMf[i][pSegment[i]][j]])
+						FuzzyCodegenMembership(pFile, pModel, i, pModel->mSegMf[i][pSegment[i]][j]);
+		}
+
+		// Odometer over the membership functions of the segments, the first input slowest
+		for (i = 0; i < pModel->mInputNum; ++i)
+			pos[i] = 0;
+		for (;;)
+		{
+			cell = 0;
+			for (i = 0; i < pModel->mInputNum; ++i)
+				cell += pModel->mSegMf[i][pSegment[i]][pos[i]] * pModel->mCellStride[i];
+
+			if (pModel->mCellStart[cell] < pModel->mCellStart[cell + 1])
+			{
+				int m0 = pModel->mSegMf[0][pSegment[0]][pos[0]];
+
+				for (i = 0; i < pModel->mInputNum; ++i)
+					needed[i][pModel->mSegMf[i][pSegment[i]][pos[i]]] = 1;
+
+				if (pass == 1)
+				{
+					// The minimum of the first 2 inputs is shared by the cells of the same pair
+					if (pModel->mInputNum >= 3)
+					{
+						int m1 = pModel->mSegMf[1][pSegment[1]][pos[1]];
+
+						if (pair != m0 * FUZZY_MF_NUM_MAX + m1)
+						{
+							pair = m0 * FUZZY_MF_NUM_MAX + m1;
+							fprintf(pFile, "\t\tf = FuzzyGenMin(mu0_%d, mu1_%d);\n", m0, m1);
+						}
+						fprintf(pFile, "\t\tw = FuzzyGenMin(f, mu2_%d);\n", pModel->mSegMf[2][pSegment[2]][pos[2]]);
+						i = 3;
+					}
+					else
+					{
+						fprintf(pFile, "\t\tw = mu0_%d;\n", m0);
+						i = 1;
+					}
+					for (; i < pModel->mInputNum; ++i)
+						fprintf(pFile, "\t\tw = FuzzyGenMin(w, mu%d_%d);\n", i, pModel->mSegMf[i][pSegment[i]][pos[i]]);
+
+					for (j = pModel->mCellStart[cell]; j < pModel->mCellStart[cell + 1]; ++j)
+					{
+						r = pModel->mCellRule[j];
+						fprintf(pFile, "\t\t// Rule %d\n\t\tden += w;\n", r);
+						for (o = 0; o < pModel->mOutputNum; ++o)
+						{
+							fprintf(pFile, "\t\tnum%d += w * (%s", o, FuzzyCodegenFloat(text, pModel->mRuleConst[o][r]));
+							for (i = 0; i < pModel->mInputNum; ++i)
+								FuzzyCodegenTerm(pFile, pModel->mRuleCoef[o][i][r], i);
+							fprintf(pFile, ");\n");
+						}
+					}
+				}
+			}
+
+			for (i = pModel->mInputNum - 1; i >= 0 && ++pos[i] == pModel->mSegMfNum[i][pSegment[i]]; --i)
+				pos[i] = 0;
+			if (i < 0)
+				break;
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyModelGenerate(const FuzzyModel *pModel, const char *pName, const char *pHeaderName, const char *pFileName)
+{
+	FILE *pFile = fopen(pFileName, "w");
+	int segment[FUZZY_INPUT_NUM_MAX];
+	char text[FUZZY_CODEGEN_FLOAT_LEN];
+	unsigned char used[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	int i, j, o, r, caseNum = 1, index;
+
+	if (pFile == 0)
+		return 0;
+
+	fprintf(pFile, "/* Start Header -------------------------------------------------------\n\n");
+	fprintf(pFile, "Copyright (C) 2018 DigiPen Institute of Technology.\n");
+	fprintf(pFile, "Reproduction or disclosure of this file or its contents without the prior\n");
+	fprintf(pFile, "written consent of DigiPen Institute\n");
+	fprintf(pFile, "of Technology is prohibited.\n");
+	fprintf(pFile, "File Name:\t\t%s\n", strrchr(pFileName, '/') ? strrchr(pFileName, '/') + 1 : pFileName);
+	fprintf(pFile, "Purpose:\t\tFuzzy model evaluation generated by FuzzyModelGenerate, do not edit\n");
+	fprintf(pFile, "Language:\t\tC\n");
+	fprintf(pFile, "Platform:\t\tVisual Studio 2017 | Visual C++ 14.1 | Windows 10 Home\n");
+	fprintf(pFile, "Project:\t\tMAT562_FuzzyLogics_Project\n\n");
+	fprintf(pFile, "- End Header --------------------------------------------------------*/\n\n");
+
+	fprintf(pFile, "#include \"%s\"\n\n", pHeaderName);
+	fprintf(pFile, "// ---------------------------------------------------------------------------\n\n");
+	fprintf(pFile, "static __inline float FuzzyGenMin(float a, float b)\n{\n\treturn a < b ? a : b;\n}\n\n");
+	fprintf(pFile, "static __inline float FuzzyGenMu(float left, float right)\n{\n\tfloat mu = left < right ? left : right;\n\n\treturn mu > 0.0f ? mu : 0.0f;\n}\n\n");
+	fprintf(pFile, "// ---------------------------------------------------------------------------\n\n");
+
+	fprintf(pFile, "unsigned int %sHash(void)\n{\n\treturn 0x%08Xu;\n}\n\n", pName, FuzzyModelHash(pModel));
+	fprintf(pFile, "// ---------------------------------------------------------------------------\n\n");
+
+	// Membership functions used by some rule
+	memset(used, 0, sizeof(used));
+	for (r = 0; r < pModel->mRuleNum; ++r)
+		for (i = 0; i < pModel->mInputNum; ++i)
+			used[i][pModel->mRuleMf[i][r]] = 1;
+
+	// Declarations
+	fprintf(pFile, "void %s(const float *pInputs, float *pOutputs)\n{\n", pName);
+	for (i = 0; i < pModel->mInputNum; ++i)
+		fprintf(pFile, "\tconst float x%d = pInputs[%d];\n", i, i);
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		int first = 1;
+
+		for (j = 0; j < pModel->mMfNum[i]; ++j)
+			if (used[i][j])
+			{
+				fprintf(pFile, "%s mu%d_%d", first ? "\tfloat" : ",", i, j);
+				first = 0;
+			}
+		if (first == 0)
+			fprintf(pFile, ";\n");
+	}
+	fprintf(pFile, "\tfloat %sw, den = 0.0f", pModel->mInputNum >= 3 ? "f, " : "");
+	for (o = 0; o < pModel->mOutputNum; ++o)
+		fprintf(pFile, ", num%d = 0.0f", o);
+	fprintf(pFile, ";\n\tint");
+	for (i = 0; i < pModel->mInputNum; ++i)
+		fprintf(pFile, "%s s%d", i ? "," : "", i);
+	fprintf(pFile, ";\n\n");
+
+	// Outside of every support nothing fires, otherwise the segment of every input
+	fprintf(pFile, "\tif (");
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		fprintf(pFile, "%sx%d < %s", i ? " || " : "", i, FuzzyCodegenFloat(text, pModel->mSegBound[i][0]));
+		fprintf(pFile, " || x%d > %s", i, FuzzyCodegenFloat(text, pModel->mSegBound[i][pModel->mSegNum[i]]));
+	}
+	fprintf(pFile, ")\n\t{\n");
+	for (o = 0; o < pModel->mOutputNum; ++o)
+		fprintf(pFile, "\t\tpOutputs[%d] = 0.0f;\n", o);
+	fprintf(pFile, "\t\treturn;\n\t}\n\n");
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		fprintf(pFile, "\ts%d = 0", i);
+		for (j = 1; j < pModel->mSegNum[i]; ++j)
+			fprintf(pFile, " + (x%d >= %s)", i, FuzzyCodegenFloat(text, pModel->mSegBound[i][j]));
+		fprintf(pFile, ";\n");
+	}
+
+	fprintf(pFile, "\n\tswitch (");
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		fprintf(pFile, i ? " + s%d" : "s%d", i);
+		if (caseNum > 1)
+			fprintf(pFile, " * %d", caseNum);
+		caseNum *= pModel->mSegNum[i];
+	}
+	fprintf(pFile, ")\n\t{\n");
+
+	// One case per combination of segments, the first input fastest
+	for (index = 0; index < caseNum; ++index)
+	{
+		for (i = 0, j = index; i < pModel->mInputNum; ++i)
+		{
+			segment[i] = j % pModel->mSegNum[i];
+			j /= pModel->mSegNum[i];
+		}
+
+		fprintf(pFile, "\tcase %d:\n", index);
+		FuzzyCodegenCase(pFile, pModel, segment);
+		fprintf(pFile, "\t\tbreak;\n");
+	}
+	fprintf(pFile, "\t}\n");
+
+	fprintf(pFile, "\n\tif (den <= 0.0f)\n\t{\n");
+	for (o = 0; o < pModel->mOutputNum; ++o)
+		fprintf(pFile, "\t\tpOutputs[%d] = 0.0f;\n", o);
+	fprintf(pFile, "\t\treturn;\n\t}\n\n");
+
+	fprintf(pFile, "\tden = 1.0f / den;\n");
+	for (o = 0; o < pModel->mOutputNum; ++o)
+		fprintf(pFile, "\tpOutputs[%d] = num%d * den;\n", o, o);
+	fprintf(pFile, "}\n");
+
+	if (ferror(pFile) | fclose(pFile))
+		return 0;
+
+	return 1;
+}
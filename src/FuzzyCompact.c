@@ -0,0 +1,607 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyCompact.c
+Purpose:		Coverage analysis and compaction of a rule base
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "FuzzyCompact.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define FUZZY_COMPACT_POINT_NUM_MAX	(FUZZY_COMPACT_CHECK_NUM + 3 * FUZZY_MF_NUM_MAX)	// Check points along one input
+#define FUZZY_COMPACT_UNCOVERED		-1.0e30f			// Reference value of a check point where no rule fires
+#define FUZZY_COMPACT_GROUP_NUM		((FUZZY_MF_NUM_MAX + 1) * (FUZZY_MF_NUM_MAX + 1) * (FUZZY_MF_NUM_MAX + 1))	// Groups of uncovered check points
+
+/*
+Check points of a domain and the original output on them
+*/
+typedef struct FuzzyCompactGrid
+{
+	int						mInputNum;
+	int						mPointNum[FUZZY_INPUT_NUM_MAX];
+	float					mPoints[FUZZY_INPUT_NUM_MAX][FUZZY_COMPACT_POINT_NUM_MAX];
+	int						mSize;												// Product of mPointNum
+	float					*mpReference;										// Clamped output, or FUZZY_COMPACT_UNCOVERED
+}FuzzyCompactGrid;
+
+// ---------------------------------------------------------------------------
+
+// Membership of x in the triangle, with the conventions of FuzzyModel (vertical edge when a == b or b == c)
+static float FuzzyCompactMembership(const FuzzyTriangle *pMf, float x)
+{
+	if (x < pMf->a || x > pMf->c)
+		return 0.0f;
+	if (x <= pMf->b)
+		return pMf->b > pMf->a ? (x - pMf->a) / (pMf->b - pMf->a) : 1.0f;
+	return pMf->c > pMf->b ? (pMf->c - x) / (pMf->c - pMf->b) : 1.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+static int FuzzyCompactCompareFloat(const void *pA, const void *pB)
+{
+	float a = *(const float *)pA, b = *(const float *)pB;
+
+	return a < b ? -1 : a > b ? 1 : 0;
+}
+
+// ---------------------------------------------------------------------------
+
+// Sorted, distinct feet and tops of the membership functions of input i inside the domain, bounds included
+static int FuzzyCompactBreakpoints(const FuzzyRuleBase *pRuleBase, const FuzzyCompactDomain *pDomain, int i, float *pPoints)
+{
+	int m, k, num = 0, unique = 0;
+
+	pPoints[num++] = pDomain->mMin[i];
+	pPoints[num++] = pDomain->mMax[i];
+	for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+	{
+		const float *pAbc = &pRuleBase->mInputMf[i][m].a;
+
+		for (k = 0; k < 3; ++k)
+		{
+			if (pAbc[k] > pDomain->mMin[i] && pAbc[k] < pDomain->mMax[i])
+				pPoints[num++] = pAbc[k];
+		}
+	}
+
+	qsort(pPoints, num, sizeof(float), FuzzyCompactCompareFloat);
+	for (k = 0; k < num; ++k)
+	{
+		if (unique == 0 || pPoints[k] != pPoints[unique - 1])
+			pPoints[unique++] = pPoints[k];
+	}
+
+	return unique;
+}
+
+// ---------------------------------------------------------------------------
+
+// Check points: integers for discrete inputs, otherwise evenly spaced points and the breakpoints
+static void FuzzyCompactGridPoints(FuzzyCompactGrid *pGrid, const FuzzyRuleBase *pRuleBase, const FuzzyCompactDomain *pDomain)
+{
+	int i, k;
+
+	pGrid->mInputNum = pRuleBase->mInputNum;
+	pGrid->mSize = 1;
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		float *pPoints = pGrid->mPoints[i];
+		int num = 0;
+
+		if (pDomain->mDiscreteMask & (1u << i))
+		{
+			float x;
+
+			for (x = ceilf(pDomain->mMin[i]); x <= pDomain->mMax[i] && num < FUZZY_COMPACT_POINT_NUM_MAX; x += 1.0f)
+				pPoints[num++] = x;
+		}
+		else
+		{
+			num = FuzzyCompactBreakpoints(pRuleBase, pDomain, i, pPoints);
+			for (k = 0; k < FUZZY_COMPACT_CHECK_NUM; ++k)
+				pPoints[num++] = pDomain->mMin[i] + (pDomain->mMax[i] - pDomain->mMin[i]) * k / (FUZZY_COMPACT_CHECK_NUM - 1);
+			qsort(pPoints, num, sizeof(float), FuzzyCompactCompareFloat);
+		}
+
+		pGrid->mPointNum[i] = num;
+		pGrid->mSize *= num;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+// Inputs of check point p, first input varying fastest
+static void FuzzyCompactGridInputs(const FuzzyCompactGrid *pGrid, int p, float *pInputs)
+{
+	int i;
+
+	for (i = 0; i < pGrid->mInputNum; ++i)
+	{
+		pInputs[i] = pGrid->mPoints[i][p % pGrid->mPointNum[i]];
+		p /= pGrid->mPointNum[i];
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+// Clamped first output of pModel at pInputs, FUZZY_COMPACT_UNCOVERED if no rule fires
+static float FuzzyCompactOutput(const FuzzyModel *pModel, const FuzzyCompactDomain *pDomain, const float *pInputs, int *pFiringNum)
+{
+	unsigned char rules[FUZZY_RULE_NUM_MAX];
+	float firing[FUZZY_RULE_NUM_MAX], output;
+	int num;
+
+	num = FuzzyModelFiring(pModel, pInputs, rules, firing);
+	if (pFiringNum)
+	{
+		*pFiringNum += num;
+	}
+	if (num == 0)
+	{
+		return FUZZY_COMPACT_UNCOVERED;
+	}
+
+	output = FuzzyModelEvaluateSparse(pModel, pInputs);
+	return output < pDomain->mOutMin ? pDomain->mOutMin : output > pDomain->mOutMax ? pDomain->mOutMax : output;
+}
+
+// ---------------------------------------------------------------------------
+
+// Largest deviation of pRuleBase from the reference on the grid, stopping
+// past limit. A check point left without a firing rule counts as infinite
+static float FuzzyCompactError(const FuzzyRuleBase *pRuleBase, const FuzzyCompactGrid *pGrid, const FuzzyCompactDomain *pDomain, float limit)
+{
+	FuzzyModel model;
+	float inputs[FUZZY_INPUT_NUM_MAX], error = 0.0f;
+	int p;
+
+	FuzzyModelCompile(&model, pRuleBase);
+
+	for (p = 0; p < pGrid->mSize && error <= limit; ++p)
+	{
+		float output, reference = pGrid->mpReference[p];
+
+		if (reference == FUZZY_COMPACT_UNCOVERED)
+			continue;
+
+		FuzzyCompactGridInputs(pGrid, p, inputs);
+		output = FuzzyCompactOutput(&model, pDomain, inputs, 0);
+		if (output == FUZZY_COMPACT_UNCOVERED)
+			return HUGE_VALF;
+
+		error = fabsf(output - reference) > error ? fabsf(output - reference) : error;
+	}
+
+	return error;
+}
+
+// ---------------------------------------------------------------------------
+
+// Writes the antecedents and classes of rule r
+static void FuzzyCompactPrintRule(const FuzzyRuleBase *pRuleBase, int r, FILE *pReport)
+{
+	int i, o;
+
+	fprintf(pReport, "if");
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+		fprintf(pReport, "%s %s is %s", i ? " and" : "", pRuleBase->mInputName[i], pRuleBase->mInputMfName[i][pRuleBase->mRuleMf[r][i]]);
+	fprintf(pReport, " then");
+	for (o = 0; o < pRuleBase->mOutputNum; ++o)
+		fprintf(pReport, "%s %s is %s", o ? " and" : "", pRuleBase->mOutputName[o], pRuleBase->mOutputMfName[o][pRuleBase->mRuleOutput[r][o]]);
+}
+
+// ---------------------------------------------------------------------------
+
+// Input the rules r1 and r2 differ on if they have the same classes and
+// differ on one input only, -1 otherwise
+static int FuzzyCompactMergeInput(const FuzzyRuleBase *pRuleBase, int r1, int r2)
+{
+	int i, o, input = -1;
+
+	for (o = 0; o < pRuleBase->mOutputNum; ++o)
+	{
+		if (pRuleBase->mRuleOutput[r1][o] != pRuleBase->mRuleOutput[r2][o])
+			return -1;
+	}
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		if (pRuleBase->mRuleMf[r1][i] != pRuleBase->mRuleMf[r2][i])
+		{
+			if (input >= 0)
+				return -1;
+			input = i;
+		}
+	}
+
+	return input;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyRuleBaseAnalyze(const FuzzyRuleBase *pRuleBase, const FuzzyCompactDomain *pDomain, FILE *pReport)
+{
+	int i, m, r, r2, k, problemNum = 0;
+
+	// Gaps: the integers of discrete inputs, otherwise the breakpoints and the middle of every interval between them
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		float points[FUZZY_COMPACT_POINT_NUM_MAX];
+		float gapStart = 0.0f, gapEnd = 0.0f;
+		int num, inGap = 0;
+
+		if (pDomain->mDiscreteMask & (1u << i))
+		{
+			float x;
+
+			num = 0;
+			for (x = ceilf(pDomain->mMin[i]); x <= pDomain->mMax[i] && num < FUZZY_COMPACT_POINT_NUM_MAX; x += 1.0f)
+				points[num++] = x;
+		}
+		else
+		{
+			num = FuzzyCompactBreakpoints(pRuleBase, pDomain, i, points);
+			for (k = num - 1; k > 0; --k)
+			{
+				points[2 * k] = points[k];
+				points[2 * k - 1] = 0.5f * (points[k - 1] + points[k]);
+			}
+			num = 2 * num - 1;
+		}
+
+		for (k = 0; k <= num; ++k)
+		{
+			int covered = 1;
+
+			if (k < num)
+			{
+				covered = 0;
+				for (m = 0; m < pRuleBase->mMfNum[i] && !covered; ++m)
+					covered = FuzzyCompactMembership(&pRuleBase->mInputMf[i][m], points[k]) > 0.0f;
+			}
+
+			if (!covered)
+			{
+				gapStart = inGap ? gapStart : points[k];
+				gapEnd = points[k];
+				inGap = 1;
+			}
+			else if (inGap)
+			{
+				if (gapEnd == gapStart)
+					fprintf(pReport, "gap: %s has no membership function at %g\n", pRuleBase->mInputName[i], gapStart);
+				else
+					fprintf(pReport, "gap: %s has no membership function from %g to %g\n", pRuleBase->mInputName[i], gapStart, gapEnd);
+				++problemNum;
+				inGap = 0;
+			}
+		}
+	}
+
+	// Check points where no rule fires, grouped by the strongest membership
+	// function of every input (FUZZY_MF_NUM_MAX: the input is in a gap)
+	{
+		FuzzyCompactGrid grid;
+		FuzzyModel model;
+		int counts[FUZZY_COMPACT_GROUP_NUM] = { 0 };
+		int p, cell;
+
+		FuzzyCompactGridPoints(&grid, pRuleBase, pDomain);
+		FuzzyModelCompile(&model, pRuleBase);
+
+		for (p = 0; p < grid.mSize; ++p)
+		{
+			unsigned char rules[FUZZY_RULE_NUM_MAX];
+			float firing[FUZZY_RULE_NUM_MAX], inputs[FUZZY_INPUT_NUM_MAX];
+
+			FuzzyCompactGridInputs(&grid, p, inputs);
+			if (FuzzyModelFiring(&model, inputs, rules, firing) > 0)
+				continue;
+
+			cell = 0;
+			for (i = pRuleBase->mInputNum - 1; i >= 0; --i)
+			{
+				float muMax = 0.0f;
+				int mMax = FUZZY_MF_NUM_MAX;
+
+				for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+				{
+					float mu = FuzzyCompactMembership(&pRuleBase->mInputMf[i][m], inputs[i]);
+
+					mMax = mu > muMax ? m : mMax;
+					muMax = mu > muMax ? mu : muMax;
+				}
+				cell = cell * (FUZZY_MF_NUM_MAX + 1) + mMax;
+			}
+			++counts[cell];
+		}
+
+		for (cell = 0; cell < FUZZY_COMPACT_GROUP_NUM; ++cell)
+		{
+			int index = cell;
+
+			if (counts[cell] == 0)
+				continue;
+
+			fprintf(pReport, "uncovered: no rule fires on %d check points around", counts[cell]);
+			for (i = 0; i < pRuleBase->mInputNum; ++i)
+			{
+				if (index % (FUZZY_MF_NUM_MAX + 1) == FUZZY_MF_NUM_MAX)
+					fprintf(pReport, "%s %s in a gap", i ? " and" : "", pRuleBase->mInputName[i]);
+				else
+					fprintf(pReport, "%s %s is %s", i ? " and" : "", pRuleBase->mInputName[i], pRuleBase->mInputMfName[i][index % (FUZZY_MF_NUM_MAX + 1)]);
+				index /= FUZZY_MF_NUM_MAX + 1;
+			}
+			fprintf(pReport, "\n");
+			++problemNum;
+		}
+	}
+
+	// Pairs of rules
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+	{
+		for (r2 = r + 1; r2 < pRuleBase->mRuleNum; ++r2)
+		{
+			int same = 1, o, input;
+
+			for (i = 0; i < pRuleBase->mInputNum; ++i)
+				same &= pRuleBase->mRuleMf[r][i] == pRuleBase->mRuleMf[r2][i];
+
+			if (same)
+			{
+				int conflict = 0;
+
+				for (o = 0; o < pRuleBase->mOutputNum; ++o)
+					conflict |= pRuleBase->mRuleOutput[r][o] != pRuleBase->mRuleOutput[r2][o];
+
+				fprintf(pReport, "%s: rule %d repeats the antecedents of rule %d: ", conflict ? "conflict" : "duplicate", r2, r);
+				FuzzyCompactPrintRule(pRuleBase, r2, pReport);
+				fprintf(pReport, "\n");
+				++problemNum;
+				continue;
+			}
+
+			input = FuzzyCompactMergeInput(pRuleBase, r, r2);
+			if (input >= 0)
+			{
+				fprintf(pReport, "mergeable: rules %d and %d only differ on %s (%s, %s): ", r, r2, pRuleBase->mInputName[input],
+					pRuleBase->mInputMfName[input][pRuleBase->mRuleMf[r][input]], pRuleBase->mInputMfName[input][pRuleBase->mRuleMf[r2][input]]);
+				FuzzyCompactPrintRule(pRuleBase, r, pReport);
+				fprintf(pReport, "\n");
+				++problemNum;
+			}
+		}
+	}
+
+	return problemNum;
+}
+
+// ---------------------------------------------------------------------------
+
+static void FuzzyCompactRemoveRule(FuzzyRuleBase *pRuleBase, int r)
+{
+	for (; r + 1 < pRuleBase->mRuleNum; ++r)
+	{
+		memcpy(pRuleBase->mRuleMf[r], pRuleBase->mRuleMf[r + 1], sizeof(pRuleBase->mRuleMf[r]));
+		memcpy(pRuleBase->mRuleOutput[r], pRuleBase->mRuleOutput[r + 1], sizeof(pRuleBase->mRuleOutput[r]));
+	}
+	--pRuleBase->mRuleNum;
+}
+
+// ---------------------------------------------------------------------------
+
+// Replaces the rules r1 and r2 (mergeable on input) by rule r1 on a
+// membership function spanning both of theirs. Returns 0 if the input has
+// no room for a new membership function
+static int FuzzyCompactMergeRules(FuzzyRuleBase *pRuleBase, int r1, int r2, int input)
+{
+	const FuzzyTriangle *pMf1 = &pRuleBase->mInputMf[input][pRuleBase->mRuleMf[r1][input]];
+	const FuzzyTriangle *pMf2 = &pRuleBase->mInputMf[input][pRuleBase->mRuleMf[r2][input]];
+	char name1[FUZZY_NAME_LEN], name2[FUZZY_NAME_LEN];
+	FuzzyTriangle merged;
+	int m;
+
+	// A shoulder stays a shoulder, otherwise the top is between the 2 tops
+	merged.a = pMf1->a < pMf2->a ? pMf1->a : pMf2->a;
+	merged.c = pMf1->c > pMf2->c ? pMf1->c : pMf2->c;
+	if ((pMf1->a == pMf1->b && pMf1->a == merged.a) || (pMf2->a == pMf2->b && pMf2->a == merged.a))
+		merged.b = merged.a;
+	else if ((pMf1->c == pMf1->b && pMf1->c == merged.c) || (pMf2->c == pMf2->b && pMf2->c == merged.c))
+		merged.b = merged.c;
+	else
+		merged.b = 0.5f * (pMf1->b + pMf2->b);
+
+	for (m = 0; m < pRuleBase->mMfNum[input]; ++m)
+	{
+		const FuzzyTriangle *pMf = &pRuleBase->mInputMf[input][m];
+
+		if (pMf->a == merged.a && pMf->b == merged.b && pMf->c == merged.c)
+			break;
+	}
+
+	if (m == pRuleBase->mMfNum[input])
+	{
+		if (m == FUZZY_MF_NUM_MAX)
+		{
+			return 0;
+		}
+
+		memcpy(name1, pRuleBase->mInputMfName[input][pRuleBase->mRuleMf[r1][input]], FUZZY_NAME_LEN);
+		memcpy(name2, pRuleBase->mInputMfName[input][pRuleBase->mRuleMf[r2][input]], FUZZY_NAME_LEN);
+		pRuleBase->mInputMf[input][m] = merged;
+		snprintf(pRuleBase->mInputMfName[input][m], FUZZY_NAME_LEN, "%s_%s", name1, name2);
+		++pRuleBase->mMfNum[input];
+	}
+
+	pRuleBase->mRuleMf[r1][input] = m;
+	FuzzyCompactRemoveRule(pRuleBase, r2);
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+// Drops the membership functions no rule uses
+static void FuzzyCompactRemoveUnusedMfs(FuzzyRuleBase *pRuleBase)
+{
+	int i, m, r;
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		for (m = pRuleBase->mMfNum[i] - 1; m >= 0; --m)
+		{
+			int used = 0, k;
+
+			for (r = 0; r < pRuleBase->mRuleNum; ++r)
+				used |= pRuleBase->mRuleMf[r][i] == m;
+			if (used || pRuleBase->mMfNum[i] == 1)
+				continue;
+
+			for (k = m; k + 1 < pRuleBase->mMfNum[i]; ++k)
+			{
+				pRuleBase->mInputMf[i][k] = pRuleBase->mInputMf[i][k + 1];
+				memcpy(pRuleBase->mInputMfName[i][k], pRuleBase->mInputMfName[i][k + 1], FUZZY_NAME_LEN);
+			}
+			--pRuleBase->mMfNum[i];
+
+			for (r = 0; r < pRuleBase->mRuleNum; ++r)
+			{
+				if (pRuleBase->mRuleMf[r][i] > m)
+					--pRuleBase->mRuleMf[r][i];
+			}
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyRuleBaseCompact(FuzzyRuleBase *pReduced, const FuzzyRuleBase *pRuleBase, const FuzzyCompactDomain *pDomain, float tolerance, FILE *pReport)
+{
+	FuzzyCompactGrid grid;
+	FuzzyModel model;
+	FuzzyRuleBase candidate, best;
+	float inputs[FUZZY_INPUT_NUM_MAX], error = 0.0f;
+	int p, r, r2, firingNum = 0;
+
+	*pReduced = *pRuleBase;
+
+	FuzzyCompactGridPoints(&grid, pRuleBase, pDomain);
+	grid.mpReference = (float *)malloc(grid.mSize * sizeof(float));
+	if (!grid.mpReference)
+	{
+		return 0.0f;
+	}
+
+	FuzzyModelCompile(&model, pRuleBase);
+	for (p = 0; p < grid.mSize; ++p)
+	{
+		FuzzyCompactGridInputs(&grid, p, inputs);
+		grid.mpReference[p] = FuzzyCompactOutput(&model, pDomain, inputs, &firingNum);
+	}
+
+	if (pReport)
+	{
+		fprintf(pReport, "%d rules, %.2f firing per check point on average (%d check points)\n",
+			pRuleBase->mRuleNum, (float)firingNum / grid.mSize, grid.mSize);
+	}
+
+	// Greedy: apply the best change while one fits the tolerance
+	while (pReduced->mRuleNum > 1)
+	{
+		float bestError = HUGE_VALF;
+		int bestR1 = -1, bestR2 = -1;
+
+		for (r = 0; r < pReduced->mRuleNum; ++r)
+		{
+			float candidateError;
+
+			candidate = *pReduced;
+			FuzzyCompactRemoveRule(&candidate, r);
+			candidateError = FuzzyCompactError(&candidate, &grid, pDomain, bestError < tolerance ? bestError : tolerance);
+			if (candidateError <= tolerance && candidateError < bestError)
+			{
+				bestError = candidateError;
+				best = candidate;
+				bestR1 = r;
+				bestR2 = -1;
+			}
+
+			for (r2 = r + 1; r2 < pReduced->mRuleNum; ++r2)
+			{
+				int input = FuzzyCompactMergeInput(pReduced, r, r2);
+
+				if (input < 0)
+					continue;
+
+				candidate = *pReduced;
+				if (!FuzzyCompactMergeRules(&candidate, r, r2, input))
+					continue;
+
+				candidateError = FuzzyCompactError(&candidate, &grid, pDomain, bestError < tolerance ? bestError : tolerance);
+				if (candidateError <= tolerance && candidateError < bestError)
+				{
+					bestError = candidateError;
+					best = candidate;
+					bestR1 = r;
+					bestR2 = r2;
+				}
+			}
+		}
+
+		if (bestR1 < 0)
+		{
+			break;
+		}
+
+		if (pReport)
+		{
+			if (bestR2 < 0)
+			{
+				fprintf(pReport, "removed rule %d, max error %g: ", bestR1, bestError);
+				FuzzyCompactPrintRule(pReduced, bestR1, pReport);
+			}
+			else
+			{
+				fprintf(pReport, "merged rules %d and %d, max error %g: ", bestR1, bestR2, bestError);
+				FuzzyCompactPrintRule(&best, bestR1, pReport);
+			}
+			fprintf(pReport, "\n");
+		}
+
+		*pReduced = best;
+		error = bestError;
+	}
+
+	FuzzyCompactRemoveUnusedMfs(pReduced);
+
+	if (pReport)
+	{
+		firingNum = 0;
+		FuzzyModelCompile(&model, pReduced);
+		for (p = 0; p < grid.mSize; ++p)
+		{
+			FuzzyCompactGridInputs(&grid, p, inputs);
+			FuzzyCompactOutput(&model, pDomain, inputs, &firingNum);
+		}
+		fprintf(pReport, "%d rules, %.2f firing per check point on average, max error %g\n",
+			pReduced->mRuleNum, (float)firingNum / grid.mSize, error);
+	}
+
+	free(grid.mpReference);
+	return error;
+}
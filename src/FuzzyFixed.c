@@ -0,0 +1,219 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyFixed.c
+Purpose:		Fixed point fuzzy inference, bit identical across machines
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "FuzzyFixed.h"
+#include <string.h>
+#include <math.h>
+
+// ---------------------------------------------------------------------------
+
+static __inline FuzzyFixed FixedMin(FuzzyFixed a, FuzzyFixed b)
+{
+	return a < b ? a : b;
+}
+
+// ---------------------------------------------------------------------------
+
+// Rounds x * 2^shift to the nearest integer, saturated to the int range
+static int FixedRound(float x, int shift)
+{
+	double scaled = floor(ldexp((double)x, shift) + 0.5);
+
+	if (scaled >= 2147483647.0)
+		return 0x7FFFFFFF;
+	if (scaled <= -2147483648.0)
+		return (int)(-2147483647 - 1);
+	return (int)scaled;
+}
+
+// ---------------------------------------------------------------------------
+
+// Integer square root of n (largest r with r * r <= n)
+static unsigned int FixedSqrt(unsigned long long n)
+{
+	unsigned long long root = 0, bit = 1ull << 62;
+
+	while (bit > n)
+		bit >>= 2;
+
+	while (bit)
+	{
+		if (n >= root + bit)
+		{
+			n -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return (unsigned int)root;
+}
+
+// ---------------------------------------------------------------------------
+
+FuzzyFixed FuzzyFixedFromFloat(float x)
+{
+	return FixedRound(x, FUZZY_FIXED_SHIFT);
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyFixedToFloat(FuzzyFixed x)
+{
+	return (float)x * (1.0f / FUZZY_FIXED_ONE);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyFixedModelCompile(FuzzyFixedModel *pFixed, const FuzzyModel *pModel)
+{
+	int i, k, m, o, r;
+
+	memset(pFixed, 0, sizeof(FuzzyFixedModel));
+	pFixed->mpModel = pModel;
+	pFixed->mInputNum = pModel->mInputNum;
+	pFixed->mRuleNum = pModel->mRuleNum;
+	pFixed->mOutputNum = pModel->mOutputNum;
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		pFixed->mMfNum[i] = pModel->mMfNum[i];
+		for (m = 0; m < pModel->mMfNum[i]; ++m)
+		{
+			pFixed->mMfA[i][m] = FuzzyFixedFromFloat(pModel->mMfA[i][m]);
+			pFixed->mMfC[i][m] = FuzzyFixedFromFloat(pModel->mMfC[i][m]);
+			pFixed->mMfInvL[i][m] = FixedRound(pModel->mMfInvL[i][m], FUZZY_FIXED_SLOPE_SHIFT);
+			pFixed->mMfInvR[i][m] = FixedRound(pModel->mMfInvR[i][m], FUZZY_FIXED_SLOPE_SHIFT);
+			pFixed->mMfBiasL[i][m] = FuzzyFixedFromFloat(pModel->mMfBiasL[i][m]);
+			pFixed->mMfBiasR[i][m] = FuzzyFixedFromFloat(pModel->mMfBiasR[i][m]);
+		}
+
+		pFixed->mSegNum[i] = pModel->mSegNum[i];
+		for (k = 0; k <= pModel->mSegNum[i]; ++k)
+			pFixed->mSegBound[i][k] = FuzzyFixedFromFloat(pModel->mSegBound[i][k]);
+	}
+
+	for (o = 0; o < pModel->mOutputNum; ++o)
+	{
+		for (r = 0; r < pModel->mRuleNum; ++r)
+		{
+			pFixed->mRuleConst[o][r] = FuzzyFixedFromFloat(pModel->mRuleConst[o][r]);
+			for (i = 0; i < pModel->mInputNum; ++i)
+				pFixed->mRuleCoef[o][i][r] = FuzzyFixedFromFloat(pModel->mRuleCoef[o][i][r]);
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyFixedModelEvaluate(const FuzzyFixedModel *pFixed, const FuzzyFixed *pInputs, FuzzyFixed *pOutputs)
+{
+	const FuzzyModel *pModel = pFixed->mpModel;
+	FuzzyFixed mu[FUZZY_INPUT_NUM_MAX][FUZZY_MF_NUM_MAX];
+	const unsigned char *pActive[FUZZY_INPUT_NUM_MAX];
+	int activeNum[FUZZY_INPUT_NUM_MAX];
+	unsigned char rules[FUZZY_RULE_NUM_MAX];
+	FuzzyFixed firings[FUZZY_RULE_NUM_MAX];
+	long long num[FUZZY_OUTPUT_NUM_MAX];
+	long long den = 0;
+	int i, j, k, o, r, ruleNum;
+
+	// Active membership functions of every input, see FuzzyModelEvaluateSparse.
+	// Ramps in 64 bit: a vertical edge times a whole input range does not fit in 32
+	for (i = 0; i < pFixed->mInputNum; ++i)
+	{
+		const FuzzyFixed *pBound = pFixed->mSegBound[i];
+		long long x = pInputs[i];
+
+		if (x < pBound[0] || x > pBound[pFixed->mSegNum[i]])
+		{
+			for (o = 0; o < pFixed->mOutputNum; ++o)
+				pOutputs[o] = 0;
+			return;
+		}
+
+		for (k = 0, j = 1; j < pFixed->mSegNum[i]; ++j)
+			k += (x >= pBound[j]);
+
+		pActive[i] = pModel->mSegMf[i][k];
+		activeNum[i] = pModel->mSegMfNum[i][k];
+
+		for (j = 0; j < activeNum[i]; ++j)
+		{
+			int m = pActive[i][j];
+			long long left = (((x - pFixed->mMfA[i][m]) * pFixed->mMfInvL[i][m]) >> FUZZY_FIXED_SLOPE_SHIFT) + pFixed->mMfBiasL[i][m];
+			long long right = (((pFixed->mMfC[i][m] - x) * pFixed->mMfInvR[i][m]) >> FUZZY_FIXED_SLOPE_SHIFT) + pFixed->mMfBiasR[i][m];
+			long long value = left < right ? left : right;
+
+			mu[i][m] = value < 0 ? 0 : value > FUZZY_FIXED_ONE ? FUZZY_FIXED_ONE : (FuzzyFixed)value;
+		}
+	}
+
+	// Rules that can fire, walked as by the float model, with their firing strength
+	ruleNum = FuzzyModelCellRules(pModel, pActive, activeNum, rules);
+	for (j = 0; j < ruleNum; ++j)
+	{
+		r = rules[j];
+		firings[j] = mu[0][pModel->mRuleMf[0][r]];
+		for (i = 1; i < pFixed->mInputNum; ++i)
+			firings[j] = FixedMin(firings[j], mu[i][pModel->mRuleMf[i][r]]);
+		den += firings[j];
+	}
+
+	// Consequents with 2 * FUZZY_FIXED_SHIFT fraction bits, brought back to
+	// FUZZY_FIXED_SHIFT before the firing strength multiplies them
+	for (o = 0; o < pFixed->mOutputNum; ++o)
+	{
+		long long sum = 0;
+
+		for (j = 0; j < ruleNum; ++j)
+		{
+			long long w;
+
+			r = rules[j];
+			w = (long long)pFixed->mRuleConst[o][r] << FUZZY_FIXED_SHIFT;
+			for (i = 0; i < pFixed->mInputNum; ++i)
+				w += (long long)pFixed->mRuleCoef[o][i][r] * pInputs[i];
+
+			sum += (long long)firings[j] * (w >> FUZZY_FIXED_SHIFT);
+		}
+
+		num[o] = sum;
+	}
+
+	for (o = 0; o < pFixed->mOutputNum; ++o)
+		pOutputs[o] = den > 0 ? (FuzzyFixed)(num[o] / den) : 0;
+}
+
+// ---------------------------------------------------------------------------
+
+FuzzyFixed FuzzyFixedLateral(const FuzzyFixed *pForward, const FuzzyFixed *pOffset)
+{
+	long long cross = (long long)pForward[0] * pOffset[1] - (long long)pForward[1] * pOffset[0];
+	unsigned int length = FixedSqrt((unsigned long long)((long long)pForward[0] * pForward[0] + (long long)pForward[1] * pForward[1]));
+
+	if (length == 0)
+	{
+		return 0;
+	}
+
+	// 2 * FUZZY_FIXED_SHIFT fraction bits over FUZZY_FIXED_SHIFT
+	return (FuzzyFixed)(cross / (long long)length);
+}
@@ -0,0 +1,585 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyIO.c
+Purpose:		Reading and writing fuzzy rule base files (text and binary)
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "FuzzyIO.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <float.h>
+
+#define FUZZY_IO_LINE_LEN			256					// Longest line of a text rule base
+#define FUZZY_IO_DELIMITERS			" \t\r\n"
+
+// ---------------------------------------------------------------------------
+
+static char sgFuzzyIOError[256];
+
+// ---------------------------------------------------------------------------
+
+// Records the error message and returns 0, so that failures read "return FuzzyIOFail(...)"
+static int FuzzyIOFail(const char *pFormat, ...)
+{
+	va_list args;
+
+	va_start(args, pFormat);
+	vsnprintf(sgFuzzyIOError, sizeof(sgFuzzyIOError), pFormat, args);
+	va_end(args);
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------
+
+const char *FuzzyIOGetError(void)
+{
+	return sgFuzzyIOError;
+}
+
+// ---------------------------------------------------------------------------
+
+static int FuzzyIOFindName(char (*pNames)[FUZZY_NAME_LEN], int num, const char *pName)
+{
+	int i;
+
+	for (i = 0; i < num; ++i)
+	{
+		if (strcmp(pNames[i], pName) == 0)
+			return i;
+	}
+
+	return -1;
+}
+
+// ---------------------------------------------------------------------------
+
+static int FuzzyIOCopyName(char *pDest, const char *pName, int lineNum)
+{
+	if (pName == 0)
+		return FuzzyIOFail("line %d: missing name", lineNum);
+	if (strlen(pName) >= FUZZY_NAME_LEN)
+		return FuzzyIOFail("line %d: name \"%s\" is longer than %d characters", lineNum, pName, FUZZY_NAME_LEN - 1);
+
+	strcpy(pDest, pName);
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+static int FuzzyIOParseFloat(const char *pToken, float *pValue, int lineNum)
+{
+	char *pEnd;
+
+	if (pToken == 0)
+		return FuzzyIOFail("line %d: missing number", lineNum);
+
+	*pValue = (float)strtod(pToken, &pEnd);
+	if (*pEnd != 0)
+		return FuzzyIOFail("line %d: \"%s\" is not a number", lineNum, pToken);
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+// 1 if a <= b <= c, all finite. Written so that a NaN anywhere fails every comparison
+static int FuzzyIOTriangleValid(const FuzzyTriangle *pMf)
+{
+	return -FLT_MAX <= pMf->a && pMf->a <= pMf->b && pMf->b <= pMf->c && pMf->c <= FLT_MAX;
+}
+
+// ---------------------------------------------------------------------------
+
+// Parses "VAR is MF and VAR is MF ... then OUT is CLASS and OUT is CLASS ...", the "if" being already read
+static int FuzzyIOParseRule(FuzzyRuleBase *pRuleBase, int lineNum)
+{
+	int r = pRuleBase->mRuleNum;
+	int seen[FUZZY_INPUT_NUM_MAX], seenOutput[FUZZY_OUTPUT_NUM_MAX];
+	const char *pVar, *pIs, *pMf, *pNext;
+	int i, m, o;
+
+	if (r >= FUZZY_RULE_NUM_MAX)
+		return FuzzyIOFail("line %d: more than %d rules", lineNum, FUZZY_RULE_NUM_MAX);
+	if (pRuleBase->mOutputNum == 0)
+		return FuzzyIOFail("line %d: rule before the outputs are defined", lineNum);
+
+	memset(seen, 0, sizeof(seen));
+
+	for (;;)
+	{
+		pVar = strtok(0, FUZZY_IO_DELIMITERS);
+		pIs = strtok(0, FUZZY_IO_DELIMITERS);
+		pMf = strtok(0, FUZZY_IO_DELIMITERS);
+		pNext = strtok(0, FUZZY_IO_DELIMITERS);
+
+		if (pVar == 0 || pIs == 0 || pMf == 0 || strcmp(pIs, "is") != 0)
+			return FuzzyIOFail("line %d: expected \"<input> is <mf>\"", lineNum);
+
+		i = FuzzyIOFindName(pRuleBase->mInputName, pRuleBase->mInputNum, pVar);
+		if (i < 0)
+			return FuzzyIOFail("line %d: unknown input \"%s\"", lineNum, pVar);
+		if (seen[i])
+			return FuzzyIOFail("line %d: input \"%s\" used twice", lineNum, pVar);
+
+		m = FuzzyIOFindName(pRuleBase->mInputMfName[i], pRuleBase->mMfNum[i], pMf);
+		if (m < 0)
+			return FuzzyIOFail("line %d: unknown membership function \"%s\" of \"%s\"", lineNum, pMf, pVar);
+
+		pRuleBase->mRuleMf[r][i] = m;
+		seen[i] = 1;
+
+		if (pNext != 0 && strcmp(pNext, "and") == 0)
+			continue;
+		if (pNext != 0 && strcmp(pNext, "then") == 0)
+			break;
+		return FuzzyIOFail("line %d: expected \"and\" or \"then\"", lineNum);
+	}
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		if (seen[i] == 0)
+			return FuzzyIOFail("line %d: input \"%s\" missing from the rule", lineNum, pRuleBase->mInputName[i]);
+	}
+
+	memset(seenOutput, 0, sizeof(seenOutput));
+
+	for (;;)
+	{
+		pVar = strtok(0, FUZZY_IO_DELIMITERS);
+		pIs = strtok(0, FUZZY_IO_DELIMITERS);
+		pMf = strtok(0, FUZZY_IO_DELIMITERS);
+		pNext = strtok(0, FUZZY_IO_DELIMITERS);
+
+		if (pVar == 0 || pIs == 0 || pMf == 0 || strcmp(pIs, "is") != 0)
+			return FuzzyIOFail("line %d: expected \"<output> is <class>\"", lineNum);
+
+		o = FuzzyIOFindName(pRuleBase->mOutputName, pRuleBase->mOutputNum, pVar);
+		if (o < 0)
+			return FuzzyIOFail("line %d: unknown output \"%s\"", lineNum, pVar);
+		if (seenOutput[o])
+			return FuzzyIOFail("line %d: output \"%s\" used twice", lineNum, pVar);
+
+		m = FuzzyIOFindName(pRuleBase->mOutputMfName[o], pRuleBase->mOutputMfNum[o], pMf);
+		if (m < 0)
+			return FuzzyIOFail("line %d: unknown output class \"%s\" of \"%s\"", lineNum, pMf, pVar);
+
+		pRuleBase->mRuleOutput[r][o] = m;
+		seenOutput[o] = 1;
+
+		if (pNext == 0)
+			break;
+		if (strcmp(pNext, "and") != 0)
+			return FuzzyIOFail("line %d: expected \"and\" or the end of the rule", lineNum);
+	}
+
+	for (o = 0; o < pRuleBase->mOutputNum; ++o)
+	{
+		if (seenOutput[o] == 0)
+			return FuzzyIOFail("line %d: output \"%s\" missing from the rule", lineNum, pRuleBase->mOutputName[o]);
+	}
+
+	++pRuleBase->mRuleNum;
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+static int FuzzyRuleBaseLoadText(FuzzyRuleBase *pRuleBase, FILE *pFile)
+{
+	char line[FUZZY_IO_LINE_LEN];
+	int lineNum = 0;
+	int current = -1;								// Input receiving the "mf" lines, FUZZY_INPUT_NUM_MAX + o for output o
+	int i;
+
+	while (fgets(line, sizeof(line), pFile))
+	{
+		char *pComment = strchr(line, '#');
+		char *pToken;
+
+		++lineNum;
+		if (pComment)
+			*pComment = 0;
+
+		pToken = strtok(line, FUZZY_IO_DELIMITERS);
+		if (pToken == 0)
+			continue;
+
+		if (strcmp(pToken, "input") == 0)
+		{
+			if (pRuleBase->mOutputNum > 0)
+				return FuzzyIOFail("line %d: inputs must come before the outputs", lineNum);
+			if (pRuleBase->mInputNum >= FUZZY_INPUT_NUM_MAX)
+				return FuzzyIOFail("line %d: more than %d inputs", lineNum, FUZZY_INPUT_NUM_MAX);
+
+			current = pRuleBase->mInputNum++;
+			if (!FuzzyIOCopyName(pRuleBase->mInputName[current], strtok(0, FUZZY_IO_DELIMITERS), lineNum))
+				return 0;
+		}
+		else if (strcmp(pToken, "output") == 0)
+		{
+			if (pRuleBase->mRuleNum > 0)
+				return FuzzyIOFail("line %d: outputs must come before the rules", lineNum);
+			if (pRuleBase->mOutputNum >= FUZZY_OUTPUT_NUM_MAX)
+				return FuzzyIOFail("line %d: more than %d outputs", lineNum, FUZZY_OUTPUT_NUM_MAX);
+
+			current = FUZZY_INPUT_NUM_MAX + pRuleBase->mOutputNum++;
+			if (!FuzzyIOCopyName(pRuleBase->mOutputName[current - FUZZY_INPUT_NUM_MAX], strtok(0, FUZZY_IO_DELIMITERS), lineNum))
+				return 0;
+		}
+		else if (strcmp(pToken, "mf") == 0)
+		{
+			FuzzyTriangle mf;
+			char *pName = strtok(0, FUZZY_IO_DELIMITERS);
+			int output = current - FUZZY_INPUT_NUM_MAX;
+			int *pNum;
+
+			if (current < 0)
+				return FuzzyIOFail("line %d: membership function before any input", lineNum);
+
+			pNum = output >= 0 ? &pRuleBase->mOutputMfNum[output] : &pRuleBase->mMfNum[current];
+			if (*pNum >= FUZZY_MF_NUM_MAX)
+				return FuzzyIOFail("line %d: more than %d membership functions", lineNum, FUZZY_MF_NUM_MAX);
+
+			if (!FuzzyIOCopyName(output >= 0 ? pRuleBase->mOutputMfName[output][*pNum] : pRuleBase->mInputMfName[current][*pNum], pName, lineNum) ||
+				!FuzzyIOParseFloat(strtok(0, FUZZY_IO_DELIMITERS), &mf.a, lineNum) ||
+				!FuzzyIOParseFloat(strtok(0, FUZZY_IO_DELIMITERS), &mf.b, lineNum) ||
+				!FuzzyIOParseFloat(strtok(0, FUZZY_IO_DELIMITERS), &mf.c, lineNum))
+				return 0;
+
+			if (!FuzzyIOTriangleValid(&mf))
+				return FuzzyIOFail("line %d: expected finite a <= b <= c", lineNum);
+
+			if (output >= 0)
+				pRuleBase->mOutputMf[output][*pNum] = mf;
+			else
+				pRuleBase->mInputMf[current][*pNum] = mf;
+			++*pNum;
+		}
+		else if (strcmp(pToken, "if") == 0)
+		{
+			if (!FuzzyIOParseRule(pRuleBase, lineNum))
+				return 0;
+		}
+		else
+		{
+			return FuzzyIOFail("line %d: unknown statement \"%s\"", lineNum, pToken);
+		}
+	}
+
+	if (pRuleBase->mInputNum == 0 || pRuleBase->mOutputNum == 0 || pRuleBase->mRuleNum == 0)
+		return FuzzyIOFail("incomplete rule base: %d inputs, %d outputs, %d rules",
+			pRuleBase->mInputNum, pRuleBase->mOutputNum, pRuleBase->mRuleNum);
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		if (pRuleBase->mMfNum[i] == 0)
+			return FuzzyIOFail("input \"%s\" has no membership function", pRuleBase->mInputName[i]);
+	}
+
+	for (i = 0; i < pRuleBase->mOutputNum; ++i)
+	{
+		if (pRuleBase->mOutputMfNum[i] == 0)
+			return FuzzyIOFail("output \"%s\" has no class", pRuleBase->mOutputName[i]);
+	}
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+static int FuzzyIORead(void *pData, size_t size, FILE *pFile)
+{
+	if (fread(pData, size, 1, pFile) != 1)
+		return FuzzyIOFail("unexpected end of file");
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+static int FuzzyIOReadTriangle(char *pName, FuzzyTriangle *pMf, FILE *pFile)
+{
+	if (!FuzzyIORead(pName, FUZZY_NAME_LEN, pFile) ||
+		!FuzzyIORead(&pMf->a, sizeof(float), pFile) ||
+		!FuzzyIORead(&pMf->b, sizeof(float), pFile) ||
+		!FuzzyIORead(&pMf->c, sizeof(float), pFile))
+		return 0;
+
+	pName[FUZZY_NAME_LEN - 1] = 0;
+	if (!FuzzyIOTriangleValid(pMf))
+		return FuzzyIOFail("membership function \"%s\": expected finite a <= b <= c", pName);
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+static int FuzzyRuleBaseLoadBinary(FuzzyRuleBase *pRuleBase, FILE *pFile)
+{
+	unsigned char counts[4], index;
+	unsigned int version;
+	char magic[4];
+	int i, m, o, r;
+
+	if (!FuzzyIORead(magic, 4, pFile) || !FuzzyIORead(&version, sizeof(version), pFile) || !FuzzyIORead(counts, 4, pFile))
+		return 0;
+	if (version != 1 && version != FUZZY_BINARY_VERSION)
+		return FuzzyIOFail("unsupported binary version %u", version);
+
+	// Version 1 has a single output, counts[1] is its number of classes
+	if (version == 1)
+	{
+		pRuleBase->mOutputNum = 1;
+		pRuleBase->mOutputMfNum[0] = counts[1];
+	}
+	else
+	{
+		pRuleBase->mOutputNum = counts[1];
+	}
+
+	if (counts[0] == 0 || counts[0] > FUZZY_INPUT_NUM_MAX || pRuleBase->mOutputNum == 0 || pRuleBase->mOutputNum > FUZZY_OUTPUT_NUM_MAX ||
+		counts[2] == 0 || counts[2] > FUZZY_RULE_NUM_MAX)
+		return FuzzyIOFail("invalid counts: %d inputs, %d outputs, %d rules", counts[0], pRuleBase->mOutputNum, counts[2]);
+
+	pRuleBase->mInputNum = counts[0];
+	pRuleBase->mRuleNum = counts[2];
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		if (!FuzzyIORead(pRuleBase->mInputName[i], FUZZY_NAME_LEN, pFile) || !FuzzyIORead(&index, 1, pFile))
+			return 0;
+		if (index == 0 || index > FUZZY_MF_NUM_MAX)
+			return FuzzyIOFail("input %d: invalid membership function count %d", i, index);
+
+		pRuleBase->mInputName[i][FUZZY_NAME_LEN - 1] = 0;
+		pRuleBase->mMfNum[i] = index;
+
+		for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+		{
+			if (!FuzzyIOReadTriangle(pRuleBase->mInputMfName[i][m], &pRuleBase->mInputMf[i][m], pFile))
+				return 0;
+		}
+	}
+
+	for (o = 0; o < pRuleBase->mOutputNum; ++o)
+	{
+		if (!FuzzyIORead(pRuleBase->mOutputName[o], FUZZY_NAME_LEN, pFile))
+			return 0;
+		pRuleBase->mOutputName[o][FUZZY_NAME_LEN - 1] = 0;
+
+		if (version != 1)
+		{
+			if (!FuzzyIORead(&index, 1, pFile))
+				return 0;
+			pRuleBase->mOutputMfNum[o] = index;
+		}
+		if (pRuleBase->mOutputMfNum[o] == 0 || pRuleBase->mOutputMfNum[o] > FUZZY_MF_NUM_MAX)
+			return FuzzyIOFail("output %d: invalid class count %d", o, pRuleBase->mOutputMfNum[o]);
+
+		for (m = 0; m < pRuleBase->mOutputMfNum[o]; ++m)
+		{
+			if (!FuzzyIOReadTriangle(pRuleBase->mOutputMfName[o][m], &pRuleBase->mOutputMf[o][m], pFile))
+				return 0;
+		}
+	}
+
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+	{
+		for (i = 0; i < pRuleBase->mInputNum + pRuleBase->mOutputNum; ++i)
+		{
+			int output = i - pRuleBase->mInputNum;
+			int num = output < 0 ? pRuleBase->mMfNum[i] : pRuleBase->mOutputMfNum[output];
+
+			if (!FuzzyIORead(&index, 1, pFile))
+				return 0;
+			if (index >= num)
+				return FuzzyIOFail("rule %d: invalid membership function index %d", r, index);
+
+			if (output < 0)
+				pRuleBase->mRuleMf[r][i] = index;
+			else
+				pRuleBase->mRuleOutput[r][output] = index;
+		}
+	}
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyRuleBaseLoad(FuzzyRuleBase *pRuleBase, const char *pFileName)
+{
+	FILE *pFile = fopen(pFileName, "rb");
+	char magic[4];
+	int result;
+
+	memset(pRuleBase, 0, sizeof(FuzzyRuleBase));
+
+	if (pFile == 0)
+		return FuzzyIOFail("%s: cannot open file", pFileName);
+
+	if (fread(magic, 4, 1, pFile) == 1 && memcmp(magic, FUZZY_BINARY_MAGIC, 4) == 0)
+	{
+		rewind(pFile);
+		result = FuzzyRuleBaseLoadBinary(pRuleBase, pFile);
+	}
+	else
+	{
+		rewind(pFile);
+		result = FuzzyRuleBaseLoadText(pRuleBase, pFile);
+	}
+
+	fclose(pFile);
+
+	if (result == 0)
+	{
+		// Prefix the error with the file name
+		char error[sizeof(sgFuzzyIOError)];
+
+		strcpy(error, sgFuzzyIOError);
+		FuzzyIOFail("%s: %s", pFileName, error);
+		memset(pRuleBase, 0, sizeof(FuzzyRuleBase));
+	}
+
+	return result;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyRuleBaseSaveText(const FuzzyRuleBase *pRuleBase, const char *pFileName)
+{
+	FILE *pFile = fopen(pFileName, "w");
+	int i, m, o, r;
+
+	if (pFile == 0)
+		return FuzzyIOFail("%s: cannot open file", pFileName);
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		fprintf(pFile, "input %s\n", pRuleBase->mInputName[i]);
+		for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+		{
+			const FuzzyTriangle *pMf = &pRuleBase->mInputMf[i][m];
+
+			fprintf(pFile, "\tmf %s %g %g %g\n", pRuleBase->mInputMfName[i][m], pMf->a, pMf->b, pMf->c);
+		}
+		fprintf(pFile, "\n");
+	}
+
+	for (o = 0; o < pRuleBase->mOutputNum; ++o)
+	{
+		fprintf(pFile, "output %s\n", pRuleBase->mOutputName[o]);
+		for (m = 0; m < pRuleBase->mOutputMfNum[o]; ++m)
+		{
+			const FuzzyTriangle *pMf = &pRuleBase->mOutputMf[o][m];
+
+			fprintf(pFile, "\tmf %s %g %g %g\n", pRuleBase->mOutputMfName[o][m], pMf->a, pMf->b, pMf->c);
+		}
+		fprintf(pFile, "\n");
+	}
+
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+	{
+		fprintf(pFile, "if");
+		for (i = 0; i < pRuleBase->mInputNum; ++i)
+		{
+			fprintf(pFile, "%s %s is %s", i ? " and" : "", pRuleBase->mInputName[i], pRuleBase->mInputMfName[i][pRuleBase->mRuleMf[r][i]]);
+		}
+		fprintf(pFile, " then");
+		for (o = 0; o < pRuleBase->mOutputNum; ++o)
+		{
+			fprintf(pFile, "%s %s is %s", o ? " and" : "", pRuleBase->mOutputName[o], pRuleBase->mOutputMfName[o][pRuleBase->mRuleOutput[r][o]]);
+		}
+		fprintf(pFile, "\n");
+	}
+
+	if (fclose(pFile) != 0)
+		return FuzzyIOFail("%s: write failed", pFileName);
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+static void FuzzyIOWriteTriangle(const char *pName, const FuzzyTriangle *pMf, FILE *pFile)
+{
+	fwrite(pName, FUZZY_NAME_LEN, 1, pFile);
+	fwrite(&pMf->a, sizeof(float), 1, pFile);
+	fwrite(&pMf->b, sizeof(float), 1, pFile);
+	fwrite(&pMf->c, sizeof(float), 1, pFile);
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyRuleBaseSaveBinary(const FuzzyRuleBase *pRuleBase, const char *pFileName)
+{
+	FILE *pFile = fopen(pFileName, "wb");
+	unsigned int version = FUZZY_BINARY_VERSION;
+	unsigned char counts[4], index;
+	int i, m, o, r;
+
+	if (pFile == 0)
+		return FuzzyIOFail("%s: cannot open file", pFileName);
+
+	counts[0] = (unsigned char)pRuleBase->mInputNum;
+	counts[1] = (unsigned char)pRuleBase->mOutputNum;
+	counts[2] = (unsigned char)pRuleBase->mRuleNum;
+	counts[3] = 0;
+
+	fwrite(FUZZY_BINARY_MAGIC, 4, 1, pFile);
+	fwrite(&version, sizeof(version), 1, pFile);
+	fwrite(counts, 4, 1, pFile);
+
+	for (i = 0; i < pRuleBase->mInputNum; ++i)
+	{
+		index = (unsigned char)pRuleBase->mMfNum[i];
+		fwrite(pRuleBase->mInputName[i], FUZZY_NAME_LEN, 1, pFile);
+		fwrite(&index, 1, 1, pFile);
+
+		for (m = 0; m < pRuleBase->mMfNum[i]; ++m)
+			FuzzyIOWriteTriangle(pRuleBase->mInputMfName[i][m], &pRuleBase->mInputMf[i][m], pFile);
+	}
+
+	for (o = 0; o < pRuleBase->mOutputNum; ++o)
+	{
+		index = (unsigned char)pRuleBase->mOutputMfNum[o];
+		fwrite(pRuleBase->mOutputName[o], FUZZY_NAME_LEN, 1, pFile);
+		fwrite(&index, 1, 1, pFile);
+
+		for (m = 0; m < pRuleBase->mOutputMfNum[o]; ++m)
+			FuzzyIOWriteTriangle(pRuleBase->mOutputMfName[o][m], &pRuleBase->mOutputMf[o][m], pFile);
+	}
+
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+	{
+		for (i = 0; i < pRuleBase->mInputNum; ++i)
+		{
+			index = (unsigned char)pRuleBase->mRuleMf[r][i];
+			fwrite(&index, 1, 1, pFile);
+		}
+		for (o = 0; o < pRuleBase->mOutputNum; ++o)
+		{
+			index = (unsigned char)pRuleBase->mRuleOutput[r][o];
+			fwrite(&index, 1, 1, pFile);
+		}
+	}
+
+	if (ferror(pFile) | fclose(pFile))
+		return FuzzyIOFail("%s: write failed", pFileName);
+
+	return 1;
+}
@@ -0,0 +1,343 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyMembership.c
+Purpose:		Branchless membership functions, evaluated over arrays of functions and of inputs
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "FuzzyMembership.h"
+#include "FuzzyVec.h"
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+// ---------------------------------------------------------------------------
+
+static __inline float MfMin(float a, float b)
+{
+	return a < b ? a : b;
+}
+
+static __inline float MfMax(float a, float b)
+{
+	return a > b ? a : b;
+}
+
+// ---------------------------------------------------------------------------
+
+// Ramp form of the function m of pSet, see FuzzyMfSet
+static void MfCompileRamps(FuzzyMfSet *pSet, int m, const FuzzyMf *pMf)
+{
+	const float *p = pMf->mParam;
+	float a, b, c, d;
+	int openL = 0, openR = 0;
+
+	// Everything as a trapezoid a b c d
+	switch (pMf->mType)
+	{
+	case FUZZY_MF_TRIANGLE:
+		a = p[0]; b = c = p[1]; d = p[2];
+		break;
+	case FUZZY_MF_TRAPEZOID:
+		a = p[0]; b = p[1]; c = p[2]; d = p[3];
+		break;
+	case FUZZY_MF_SHOULDER_LEFT:
+		a = b = c = p[0]; d = p[1];
+		openL = 1;
+		break;
+	case FUZZY_MF_SHOULDER_RIGHT:
+		a = p[0]; b = c = d = p[1];
+		openR = 1;
+		break;
+	default:
+		// Smooth shapes: both ramps stay at 1, the value is computed afterwards
+		a = b = c = d = 0.0f;
+		openL = openR = 1;
+		break;
+	}
+
+	pSet->mA[m] = a;
+	pSet->mD[m] = d;
+
+	if (openL)
+	{
+		pSet->mInvL[m] = 0.0f;
+		pSet->mBiasL[m] = 1.0f;
+	}
+	else if (b > a)
+	{
+		pSet->mInvL[m] = 1.0f / (b - a);
+		pSet->mBiasL[m] = 0.0f;
+	}
+	else
+	{
+		pSet->mInvL[m] = FUZZY_SHOULDER_SLOPE;
+		pSet->mBiasL[m] = 1.0f;
+	}
+
+	if (openR)
+	{
+		pSet->mInvR[m] = 0.0f;
+		pSet->mBiasR[m] = 1.0f;
+	}
+	else if (d > c)
+	{
+		pSet->mInvR[m] = 1.0f / (d - c);
+		pSet->mBiasR[m] = 0.0f;
+	}
+	else
+	{
+		pSet->mInvR[m] = FUZZY_SHOULDER_SLOPE;
+		pSet->mBiasR[m] = 1.0f;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+static __inline float MfRamps(const FuzzyMfSet *pSet, int m, float x)
+{
+	float left = (x - pSet->mA[m]) * pSet->mInvL[m] + pSet->mBiasL[m];
+	float right = (pSet->mD[m] - x) * pSet->mInvR[m] + pSet->mBiasR[m];
+
+	return MfMax(0.0f, MfMin(1.0f, MfMin(left, right)));
+}
+
+// ---------------------------------------------------------------------------
+
+static __inline float MfSmooth(const FuzzyMfSet *pSet, int m, float x)
+{
+	float offset = x - pSet->mCenter[m];
+
+	if (pSet->mType[m] == FUZZY_MF_GAUSSIAN)
+		return expf(pSet->mScale[m] * offset * offset);
+	return 1.0f / (1.0f + expf(pSet->mScale[m] * offset));
+}
+
+// ---------------------------------------------------------------------------
+
+FuzzyMf FuzzyMfTriangle(float a, float b, float c)
+{
+	FuzzyMf mf = { FUZZY_MF_TRIANGLE, { a, b, c, 0.0f } };
+	return mf;
+}
+
+FuzzyMf FuzzyMfTrapezoid(float a, float b, float c, float d)
+{
+	FuzzyMf mf = { FUZZY_MF_TRAPEZOID, { a, b, c, d } };
+	return mf;
+}
+
+FuzzyMf FuzzyMfShoulderLeft(float top, float foot)
+{
+	FuzzyMf mf = { FUZZY_MF_SHOULDER_LEFT, { top, foot, 0.0f, 0.0f } };
+	return mf;
+}
+
+FuzzyMf FuzzyMfShoulderRight(float foot, float top)
+{
+	FuzzyMf mf = { FUZZY_MF_SHOULDER_RIGHT, { foot, top, 0.0f, 0.0f } };
+	return mf;
+}
+
+FuzzyMf FuzzyMfGaussian(float center, float sigma)
+{
+	FuzzyMf mf = { FUZZY_MF_GAUSSIAN, { center, sigma, 0.0f, 0.0f } };
+	return mf;
+}
+
+FuzzyMf FuzzyMfSigmoid(float center, float slope)
+{
+	FuzzyMf mf = { FUZZY_MF_SIGMOID, { center, slope, 0.0f, 0.0f } };
+	return mf;
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyMfEvaluate(const FuzzyMf *pMf, float x)
+{
+	const float *p = pMf->mParam;
+	float a, b, c, d;
+
+	// Everything as a trapezoid a b c d, an open side reaching past any input
+	switch (pMf->mType)
+	{
+	case FUZZY_MF_GAUSSIAN:
+		// A zero deviation is a spike at the center
+		if (p[1] == 0.0f)
+			return x == p[0] ? 1.0f : 0.0f;
+		return expf(-0.5f * (x - p[0]) * (x - p[0]) / (p[1] * p[1]));
+	case FUZZY_MF_SIGMOID:
+		return 1.0f / (1.0f + expf(-p[1] * (x - p[0])));
+	case FUZZY_MF_TRIANGLE:
+		a = p[0]; b = c = p[1]; d = p[2];
+		break;
+	case FUZZY_MF_TRAPEZOID:
+		a = p[0]; b = p[1]; c = p[2]; d = p[3];
+		break;
+	case FUZZY_MF_SHOULDER_LEFT:
+		a = b = -FLT_MAX; c = p[0]; d = p[1];
+		break;
+	case FUZZY_MF_SHOULDER_RIGHT:
+		a = p[0]; b = p[1]; c = d = FLT_MAX;
+		break;
+	default:
+		return 0.0f;
+	}
+
+	// An edge is only divided by once x is strictly inside of it, so a
+	// vertical edge (a == b or c == d) is never divided by: its top is 1
+	if (x < a || x > d)
+		return 0.0f;
+	if (x < b)
+		return (x - a) / (b - a);
+	if (x <= c)
+		return 1.0f;
+	return (d - x) / (d - c);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyMfSetCompile(FuzzyMfSet *pSet, const FuzzyMf *pMfs, int num)
+{
+	int m;
+
+	memset(pSet, 0, sizeof(FuzzyMfSet));
+	pSet->mNum = num;
+
+	for (m = 0; m < num; ++m)
+	{
+		const FuzzyMf *pMf = pMfs + m;
+
+		pSet->mType[m] = (unsigned char)pMf->mType;
+		MfCompileRamps(pSet, m, pMf);
+
+		if (pMf->mType == FUZZY_MF_GAUSSIAN)
+		{
+			pSet->mSmoothMf[pSet->mSmoothNum++] = (unsigned char)m;
+			pSet->mCenter[m] = pMf->mParam[0];
+			pSet->mScale[m] = -0.5f / (pMf->mParam[1] * pMf->mParam[1]);
+		}
+		else if (pMf->mType == FUZZY_MF_SIGMOID)
+		{
+			pSet->mSmoothMf[pSet->mSmoothNum++] = (unsigned char)m;
+			pSet->mCenter[m] = pMf->mParam[0];
+			pSet->mScale[m] = -pMf->mParam[1];
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyMfSetCompileTriangles(FuzzyMfSet *pSet, const FuzzyTriangle *pTriangles, int num)
+{
+	FuzzyMf mfs[FUZZY_MF_NUM_MAX];
+	int m;
+
+	for (m = 0; m < num; ++m)
+		mfs[m] = FuzzyMfTriangle(pTriangles[m].a, pTriangles[m].b, pTriangles[m].c);
+
+	FuzzyMfSetCompile(pSet, mfs, num);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyMfSetEvaluate(const FuzzyMfSet *pSet, float x, float *pMu)
+{
+	int m, s;
+
+#if FUZZY_VEC_LANES > 1
+	// The set is padded to FUZZY_MF_NUM_MAX functions (all 0), so whole
+	// vectors are computed and only the used memberships are copied
+	float mu[FUZZY_MF_NUM_MAX];
+	FuzzyVec vx = FuzzyVecSet1(x), zero = FuzzyVecSet1(0.0f), one = FuzzyVecSet1(1.0f);
+
+	for (m = 0; m < pSet->mNum; m += FUZZY_VEC_LANES)
+	{
+		FuzzyVec left = FuzzyVecAdd(FuzzyVecMul(FuzzyVecSub(vx, FuzzyVecLoad(pSet->mA + m)), FuzzyVecLoad(pSet->mInvL + m)), FuzzyVecLoad(pSet->mBiasL + m));
+		FuzzyVec right = FuzzyVecAdd(FuzzyVecMul(FuzzyVecSub(FuzzyVecLoad(pSet->mD + m), vx), FuzzyVecLoad(pSet->mInvR + m)), FuzzyVecLoad(pSet->mBiasR + m));
+
+		FuzzyVecStore(mu + m, FuzzyVecMax(zero, FuzzyVecMin(one, FuzzyVecMin(left, right))));
+	}
+	memcpy(pMu, mu, pSet->mNum * sizeof(float));
+#else
+	for (m = 0; m < pSet->mNum; ++m)
+		pMu[m] = MfRamps(pSet, m, x);
+#endif
+
+	for (s = 0; s < pSet->mSmoothNum; ++s)
+	{
+		m = pSet->mSmoothMf[s];
+		pMu[m] = MfSmooth(pSet, m, x);
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyMfSetEvaluateArray(const FuzzyMfSet *pSet, const float *pX, int num, float *pMu)
+{
+	int m, s, j;
+
+	// One function per row, the inner loops only read constants and pX
+	for (m = 0; m < pSet->mNum; ++m)
+	{
+		float a = pSet->mA[m], invL = pSet->mInvL[m], biasL = pSet->mBiasL[m];
+		float d = pSet->mD[m], invR = pSet->mInvR[m], biasR = pSet->mBiasR[m];
+		float *pRow = pMu + m * num;
+
+		j = 0;
+#if FUZZY_VEC_LANES > 1
+		{
+			FuzzyVec va = FuzzyVecSet1(a), vInvL = FuzzyVecSet1(invL), vBiasL = FuzzyVecSet1(biasL);
+			FuzzyVec vd = FuzzyVecSet1(d), vInvR = FuzzyVecSet1(invR), vBiasR = FuzzyVecSet1(biasR);
+			FuzzyVec zero = FuzzyVecSet1(0.0f), one = FuzzyVecSet1(1.0f);
+
+			for (; j + FUZZY_VEC_LANES <= num; j += FUZZY_VEC_LANES)
+			{
+				FuzzyVec x = FuzzyVecLoad(pX + j);
+				FuzzyVec left = FuzzyVecAdd(FuzzyVecMul(FuzzyVecSub(x, va), vInvL), vBiasL);
+				FuzzyVec right = FuzzyVecAdd(FuzzyVecMul(FuzzyVecSub(vd, x), vInvR), vBiasR);
+
+				FuzzyVecStore(pRow + j, FuzzyVecMax(zero, FuzzyVecMin(one, FuzzyVecMin(left, right))));
+			}
+		}
+#endif
+		for (; j < num; ++j)
+		{
+			float left = (pX[j] - a) * invL + biasL;
+			float right = (d - pX[j]) * invR + biasR;
+
+			pRow[j] = MfMax(0.0f, MfMin(1.0f, MfMin(left, right)));
+		}
+	}
+
+	for (s = 0; s < pSet->mSmoothNum; ++s)
+	{
+		float center, scale;
+		float *pRow;
+
+		m = pSet->mSmoothMf[s];
+		center = pSet->mCenter[m];
+		scale = pSet->mScale[m];
+		pRow = pMu + m * num;
+
+		if (pSet->mType[m] == FUZZY_MF_GAUSSIAN)
+		{
+			for (j = 0; j < num; ++j)
+				pRow[j] = expf(scale * (pX[j] - center) * (pX[j] - center));
+		}
+		else
+		{
+			for (j = 0; j < num; ++j)
+				pRow[j] = 1.0f / (1.0f + expf(scale * (pX[j] - center)));
+		}
+	}
+}
@@ -0,0 +1,158 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyMemo.c
+Purpose:		Fixed size memo of a fuzzy model's output, keyed on quantized inputs
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "FuzzyMemo.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define FUZZY_MEMO_KEY_HALF			(1 << (FUZZY_MEMO_KEY_BITS - 1))	// Offset making a quantized input positive
+#define FUZZY_MEMO_KEY_USED			(1ull << 63)						// Set in every key, an empty slot has a key of 0
+
+// ---------------------------------------------------------------------------
+
+void FuzzyMemoFree(FuzzyMemo *pMemo)
+{
+	// All the shards are in the block of the first one
+	if (pMemo->mShards[0].mpEntries)
+	{
+		free(pMemo->mShards[0].mpEntries);
+	}
+	memset(pMemo->mShards, 0, sizeof(pMemo->mShards));
+	pMemo->mShardNum = 0;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyMemoInit(FuzzyMemo *pMemo, const FuzzyModel *pModel, const float *pStep, float outMin, float outMax,
+	int entryNum, int shardNum)
+{
+	FuzzyMemoEntry *pEntries;
+	unsigned int size = 1;
+	int i;
+
+	FuzzyMemoFree(pMemo);
+
+	while ((int)size < entryNum)
+		size <<= 1;
+	shardNum = shardNum < 1 ? 1 : shardNum > FUZZY_MEMO_SHARD_NUM_MAX ? FUZZY_MEMO_SHARD_NUM_MAX : shardNum;
+
+	pEntries = (FuzzyMemoEntry *)calloc((size_t)size * shardNum, sizeof(FuzzyMemoEntry));
+	if (pEntries == 0)
+	{
+		return 0;
+	}
+
+	pMemo->mpModel = pModel;
+	pMemo->mOutMin = outMin;
+	pMemo->mOutMax = outMax;
+	pMemo->mEntryMask = size - 1;
+	pMemo->mShardNum = shardNum;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		pMemo->mStep[i] = i < pModel->mInputNum ? pStep[i] : 1.0f;
+		pMemo->mInvStep[i] = 1.0f / pMemo->mStep[i];
+	}
+
+	for (i = 0; i < shardNum; ++i)
+		pMemo->mShards[i].mpEntries = pEntries + (size_t)i * size;
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyMemoClear(FuzzyMemo *pMemo)
+{
+	int i;
+
+	for (i = 0; i < pMemo->mShardNum; ++i)
+	{
+		memset(pMemo->mShards[i].mpEntries, 0, (pMemo->mEntryMask + 1) * sizeof(FuzzyMemoEntry));
+		pMemo->mShards[i].mHitNum = 0;
+		pMemo->mShards[i].mMissNum = 0;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyMemoEvaluate(FuzzyMemo *pMemo, int shard, const float *pInputs)
+{
+	FuzzyMemoShard *pShard = pMemo->mShards + shard;
+	const FuzzyModel *pModel = pMemo->mpModel;
+	float rounded[FUZZY_INPUT_NUM_MAX];
+	unsigned long long key = FUZZY_MEMO_KEY_USED, hash;
+	unsigned int slot, home;
+	float output;
+	int i, probe;
+
+	for (i = 0; i < pModel->mInputNum; ++i)
+	{
+		// Nearest multiple of the step, kept inside the key's range
+		int q = (int)floorf(pInputs[i] * pMemo->mInvStep[i] + 0.5f);
+
+		q = q < -FUZZY_MEMO_KEY_HALF ? -FUZZY_MEMO_KEY_HALF : q > FUZZY_MEMO_KEY_HALF - 1 ? FUZZY_MEMO_KEY_HALF - 1 : q;
+		rounded[i] = q * pMemo->mStep[i];
+		key |= (unsigned long long)(q + FUZZY_MEMO_KEY_HALF) << (i * FUZZY_MEMO_KEY_BITS);
+	}
+
+	// Multiplicative hash, the top bits are the best mixed
+	hash = key * 0x9E3779B97F4A7C15ull;
+	home = (unsigned int)(hash >> 32) & pMemo->mEntryMask;
+
+	for (probe = 0; probe < FUZZY_MEMO_PROBE_NUM; ++probe)
+	{
+		FuzzyMemoEntry *pEntry = pShard->mpEntries + ((home + probe) & pMemo->mEntryMask);
+
+		if (pEntry->mKey == key)
+		{
+			++pShard->mHitNum;
+			return pEntry->mOutput;
+		}
+		if (pEntry->mKey == 0)
+		{
+			break;
+		}
+	}
+
+	// An empty slot ends the search, otherwise the home slot is replaced
+	slot = probe < FUZZY_MEMO_PROBE_NUM ? (home + probe) & pMemo->mEntryMask : home;
+
+	output = FuzzyModelEvaluateSparse(pModel, rounded);
+	output = output < pMemo->mOutMin ? pMemo->mOutMin : output > pMemo->mOutMax ? pMemo->mOutMax : output;
+
+	++pShard->mMissNum;
+	pShard->mpEntries[slot].mKey = key;
+	pShard->mpEntries[slot].mOutput = output;
+
+	return output;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyMemoGetStats(const FuzzyMemo *pMemo, unsigned int *pHitNum, unsigned int *pMissNum)
+{
+	int i;
+
+	*pHitNum = 0;
+	*pMissNum = 0;
+	for (i = 0; i < pMemo->mShardNum; ++i)
+	{
+		*pHitNum += pMemo->mShards[i].mHitNum;
+		*pMissNum += pMemo->mShards[i].mMissNum;
+	}
+}
@@ -0,0 +1,620 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyOctree.c
+Purpose:		Adaptive octree lookup table of a fuzzy model, saved to and memory mapped from disk
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "FuzzyOctree.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#define OCTREE_BREAK_NUM_MAX		(4 * FUZZY_MF_NUM_MAX + 2)	// Breakpoints of an input in a cell, with the cell bounds
+#define OCTREE_CHECK_POINT_NUM_MAX	((OCTREE_BREAK_NUM_MAX - 1) * (FUZZY_OCTREE_CHECK_NUM + 1) + 1)
+
+// Cell waiting to be built: the node to fill and the box it covers
+typedef struct OctreeCell
+{
+	unsigned int			mNode;
+	int						mDepth;
+	float					mLo[FUZZY_INPUT_NUM_MAX];
+	float					mHi[FUZZY_INPUT_NUM_MAX];
+}OctreeCell;
+
+// What the model is sampled against while building
+typedef struct OctreeContext
+{
+	const FuzzyModel		*mpModel;
+	float					mMin[FUZZY_INPUT_NUM_MAX];		// Domain of the model (the octree's can be larger)
+	float					mMax[FUZZY_INPUT_NUM_MAX];
+	float					mOutMin, mOutMax;
+	unsigned int			mDiscreteMask;
+	float					*mpErrors;						// Signed errors of the check points of the current cell
+	unsigned int			mErrorCapacity;
+}OctreeContext;
+
+// ---------------------------------------------------------------------------
+
+static __inline float OctreeInterpolate(const float *pCorners, const float *pT)
+{
+	float c00 = pCorners[0] + (pCorners[1] - pCorners[0]) * pT[0];
+	float c10 = pCorners[2] + (pCorners[3] - pCorners[2]) * pT[0];
+	float c01 = pCorners[4] + (pCorners[5] - pCorners[4]) * pT[0];
+	float c11 = pCorners[6] + (pCorners[7] - pCorners[6]) * pT[0];
+	float c0 = c00 + (c10 - c00) * pT[1];
+	float c1 = c01 + (c11 - c01) * pT[1];
+
+	return c0 + (c1 - c0) * pT[2];
+}
+
+// ---------------------------------------------------------------------------
+
+static float OctreeEvaluateExact(const OctreeContext *pContext, const float *pInputs)
+{
+	float inputs[FUZZY_INPUT_NUM_MAX];
+	float output;
+	int i;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		inputs[i] = pInputs[i];
+		if (inputs[i] > pContext->mMax[i])
+			inputs[i] = pContext->mMax[i];
+	}
+
+	output = FuzzyModelEvaluate(pContext->mpModel, inputs);
+
+	if (output < pContext->mOutMin)
+		return pContext->mOutMin;
+	if (output > pContext->mOutMax)
+		return pContext->mOutMax;
+	return output;
+}
+
+// ---------------------------------------------------------------------------
+
+// Makes room for num elements of size bytes in *ppArray
+static int OctreeReserve(void **ppArray, unsigned int *pCapacity, unsigned int num, size_t size)
+{
+	void *pArray;
+	unsigned int capacity = *pCapacity;
+
+	if (num <= capacity)
+		return 1;
+
+	while (capacity < num)
+		capacity = capacity ? 2 * capacity : 1024;
+
+	pArray = realloc(*ppArray, capacity * size);
+	if (pArray == 0)
+		return 0;
+
+	*ppArray = pArray;
+	*pCapacity = capacity;
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+// Check points of input i in a cell: the cell bounds and every breakpoint of
+// the model inside (feet and peaks of the membership functions, where the
+// output bends), with FUZZY_OCTREE_CHECK_NUM points evenly spread between 2
+// of them. Integers only for a discrete input. Returns the number of points
+static int OctreeCheckPoints(const OctreeContext *pContext, const OctreeCell *pCell, int i, float *pPos)
+{
+	const FuzzyModel *pModel = pContext->mpModel;
+	float lo = pCell->mLo[i], hi = pCell->mHi[i];
+	float breaks[OCTREE_BREAK_NUM_MAX];
+	int breakNum = 0, num = 0, m, k, b;
+
+	if (hi <= lo)
+	{
+		// Input not used by the model
+		pPos[num++] = lo;
+		return num;
+	}
+
+	if (pContext->mDiscreteMask & (1u << i))
+	{
+		// Integers of the cell that the input can take
+		int last = (int)floorf(hi < pContext->mMax[i] ? hi : pContext->mMax[i]);
+
+		for (k = (int)ceilf(lo); k <= last && num < OCTREE_CHECK_POINT_NUM_MAX; ++k)
+			pPos[num++] = (float)k;
+		return num;
+	}
+
+	// Breakpoints inside the cell, sorted
+	breaks[breakNum++] = lo;
+	for (m = 0; m < pModel->mMfNum[i]; ++m)
+	{
+		float points[4];
+
+		points[0] = pModel->mMfA[i][m];
+		points[1] = pModel->mMfC[i][m];
+		points[2] = pModel->mMfBiasL[i][m] == 0.0f && pModel->mMfInvL[i][m] > 0.0f ? points[0] + 1.0f / pModel->mMfInvL[i][m] : points[0];
+		points[3] = pModel->mMfBiasR[i][m] == 0.0f && pModel->mMfInvR[i][m] > 0.0f ? points[1] - 1.0f / pModel->mMfInvR[i][m] : points[1];
+
+		for (k = 0; k < 4; ++k)
+		{
+			if (points[k] <= lo || points[k] >= hi)
+				continue;
+			for (b = breakNum; b > 0 && breaks[b - 1] > points[k]; --b)
+				breaks[b] = breaks[b - 1];
+			breaks[b] = points[k];
+			++breakNum;
+		}
+	}
+	breaks[breakNum++] = hi;
+
+	for (b = 0; b + 1 < breakNum; ++b)
+	{
+		float size = breaks[b + 1] - breaks[b];
+
+		if (size <= 0.0f)
+			continue;
+		for (k = 0; k <= FUZZY_OCTREE_CHECK_NUM; ++k)
+			pPos[num++] = breaks[b] + size * k / (FUZZY_OCTREE_CHECK_NUM + 1.0f);
+	}
+	pPos[num++] = hi;
+
+	return num;
+}
+
+// ---------------------------------------------------------------------------
+
+// Bound of the deviation between the model and the interpolated corners in a
+// cell: the largest deviation on the check points, plus half the largest
+// change of the deviation between 2 neighbor check points along every input.
+// The firing strengths are the min of the memberships, so the model also
+// bends where 2 memberships cross, off the breakpoints, and the change
+// between neighbors bounds how far the deviation goes between them.
+// Returns a negative value if memory runs out
+static float OctreeCellError(OctreeContext *pContext, const OctreeCell *pCell, const float *pCorners)
+{
+	float pos[FUZZY_INPUT_NUM_MAX][OCTREE_CHECK_POINT_NUM_MAX];
+	int num[FUZZY_INPUT_NUM_MAX], index[FUZZY_INPUT_NUM_MAX], stride[FUZZY_INPUT_NUM_MAX];
+	float inputs[FUZZY_INPUT_NUM_MAX], local[FUZZY_INPUT_NUM_MAX], jump[FUZZY_INPUT_NUM_MAX];
+	float maxError = 0.0f, bound;
+	int i, check, totalNum = 1;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		num[i] = OctreeCheckPoints(pContext, pCell, i, pos[i]);
+
+		// No input can land in this cell
+		if (num[i] == 0)
+			return 0.0f;
+		stride[i] = totalNum;
+		totalNum *= num[i];
+		jump[i] = 0.0f;
+	}
+
+	if (!OctreeReserve((void **)&pContext->mpErrors, &pContext->mErrorCapacity, totalNum, sizeof(float)))
+		return -1.0f;
+
+	memset(index, 0, sizeof(index));
+	for (check = 0; check < totalNum; ++check)
+	{
+		float error;
+
+		for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		{
+			float size = pCell->mHi[i] - pCell->mLo[i];
+
+			inputs[i] = pos[i][index[i]];
+			local[i] = size > 0.0f ? (inputs[i] - pCell->mLo[i]) / size : 0.0f;
+		}
+
+		error = OctreeInterpolate(pCorners, local) - OctreeEvaluateExact(pContext, inputs);
+		pContext->mpErrors[check] = error;
+		if (fabsf(error) > maxError)
+			maxError = fabsf(error);
+		for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		{
+			float change;
+
+			if (index[i] == 0)
+				continue;
+			change = fabsf(error - pContext->mpErrors[check - stride[i]]);
+			if (change > jump[i])
+				jump[i] = change;
+		}
+
+		for (i = 0; i < FUZZY_INPUT_NUM_MAX && ++index[i] == num[i]; ++i)
+			index[i] = 0;
+	}
+
+	bound = maxError;
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		bound += 0.5f * jump[i];
+	return bound;
+}
+
+// ---------------------------------------------------------------------------
+
+static void OctreeSetup(FuzzyOctree *pTree)
+{
+	const FuzzyOctreeHeader *pHeader = pTree->mpHeader;
+	int i;
+
+	pTree->mpNodes = (const unsigned int *)(pHeader + 1);
+	pTree->mpLeaves = (const float *)(pTree->mpNodes + pHeader->mNodeNum);
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		pTree->mInvSize[i] = pHeader->mMax[i] > pHeader->mMin[i] ? 1.0f / (pHeader->mMax[i] - pHeader->mMin[i]) : 0.0f;
+}
+
+// ---------------------------------------------------------------------------
+
+// 1 if every leaf index is below mLeafNum and every node's children are
+// within the nodes and after it, as they are built breadth first, so that
+// FuzzyOctreeEvaluate stays in the block and always reaches a leaf
+static int OctreeCheckNodes(const FuzzyOctree *pTree)
+{
+	const FuzzyOctreeHeader *pHeader = pTree->mpHeader;
+	unsigned int n;
+
+	for (n = 0; n < pHeader->mNodeNum; ++n)
+	{
+		unsigned int node = pTree->mpNodes[n];
+
+		if (node & FUZZY_OCTREE_LEAF)
+		{
+			if ((node & ~FUZZY_OCTREE_LEAF) >= pHeader->mLeafNum)
+				return 0;
+		}
+		else if (node <= n || node + 8 > pHeader->mNodeNum)
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyOctreeBuild(FuzzyOctree *pTree, const FuzzyModel *pModel, const float *pMin, const float *pMax,
+	float outMin, float outMax, unsigned int discreteMask, float maxError, int maxDepth)
+{
+	OctreeContext context;
+	OctreeCell *pCells = 0;
+	unsigned int *pNodes = 0;
+	float *pLeaves = 0;
+	unsigned int cellNum = 0, nodeNum = 0, leafNum = 0;
+	unsigned int cellCapacity = 0, nodeCapacity = 0, leafCapacity = 0;
+	unsigned int cell;
+	FuzzyOctreeHeader *pHeader = 0;
+	float treeMax[FUZZY_INPUT_NUM_MAX];
+	float worstError = 0.0f;
+	int i, k, worstDepth = 0, result;
+
+	FuzzyOctreeFree(pTree);
+
+	context.mpModel = pModel;
+	context.mOutMin = outMin;
+	context.mOutMax = outMax;
+	context.mDiscreteMask = discreteMask;
+	context.mpErrors = 0;
+	context.mErrorCapacity = 0;
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		context.mMin[i] = i < pModel->mInputNum ? pMin[i] : 0.0f;
+		context.mMax[i] = i < pModel->mInputNum ? pMax[i] : 0.0f;
+		treeMax[i] = context.mMax[i];
+
+		// Power of 2 span, so that the corners of small enough cells are integers
+		if ((discreteMask & (1u << i)) && treeMax[i] > context.mMin[i])
+		{
+			float span = 1.0f;
+
+			while (span < context.mMax[i] - context.mMin[i])
+				span *= 2.0f;
+			treeMax[i] = context.mMin[i] + span;
+		}
+	}
+
+	// Root
+	result = OctreeReserve((void **)&pNodes, &nodeCapacity, 1, sizeof(unsigned int)) &&
+		OctreeReserve((void **)&pCells, &cellCapacity, 1, sizeof(OctreeCell));
+	if (result)
+	{
+		nodeNum = 1;
+		cellNum = 1;
+		pCells[0].mNode = 0;
+		pCells[0].mDepth = 0;
+		memcpy(pCells[0].mLo, context.mMin, sizeof(context.mMin));
+		memcpy(pCells[0].mHi, treeMax, sizeof(treeMax));
+	}
+
+	// Breadth first, so that the 8 children of a node are allocated together
+	for (cell = 0; result && cell < cellNum; ++cell)
+	{
+		OctreeCell current = pCells[cell];
+		float corners[8], inputs[FUZZY_INPUT_NUM_MAX];
+		float error;
+
+		for (k = 0; k < 8; ++k)
+		{
+			for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+				inputs[i] = (k & (1 << i)) ? current.mHi[i] : current.mLo[i];
+			corners[k] = OctreeEvaluateExact(&context, inputs);
+		}
+
+		error = OctreeCellError(&context, &current, corners);
+		if (error < 0.0f)
+		{
+			result = 0;
+			break;
+		}
+
+		if (error > maxError && current.mDepth < maxDepth)
+		{
+			if (!OctreeReserve((void **)&pNodes, &nodeCapacity, nodeNum + 8, sizeof(unsigned int)) ||
+				!OctreeReserve((void **)&pCells, &cellCapacity, cellNum + 8, sizeof(OctreeCell)))
+			{
+				result = 0;
+				break;
+			}
+
+			pNodes[current.mNode] = nodeNum;
+			for (k = 0; k < 8; ++k)
+			{
+				OctreeCell *pChild = pCells + cellNum++;
+
+				pChild->mNode = nodeNum++;
+				pChild->mDepth = current.mDepth + 1;
+				for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+				{
+					float middle = 0.5f * (current.mLo[i] + current.mHi[i]);
+
+					pChild->mLo[i] = (k & (1 << i)) ? middle : current.mLo[i];
+					pChild->mHi[i] = (k & (1 << i)) ? current.mHi[i] : middle;
+				}
+			}
+		}
+		else
+		{
+			if (!OctreeReserve((void **)&pLeaves, &leafCapacity, 8 * (leafNum + 1), sizeof(float)))
+			{
+				result = 0;
+				break;
+			}
+
+			memcpy(pLeaves + 8 * leafNum, corners, sizeof(corners));
+			pNodes[current.mNode] = FUZZY_OCTREE_LEAF | leafNum++;
+
+			if (error > worstError)
+				worstError = error;
+			if (current.mDepth > worstDepth)
+				worstDepth = current.mDepth;
+		}
+	}
+
+	// Pack the header, nodes and leaves in one block
+	if (result)
+	{
+		pHeader = (FuzzyOctreeHeader *)malloc(sizeof(FuzzyOctreeHeader) + nodeNum * sizeof(unsigned int) + 8 * leafNum * sizeof(float));
+		result = pHeader != 0;
+	}
+
+	if (result)
+	{
+		memset(pHeader, 0, sizeof(FuzzyOctreeHeader));
+		memcpy(pHeader->mMagic, FUZZY_OCTREE_MAGIC, 4);
+		pHeader->mVersion = FUZZY_OCTREE_VERSION;
+		pHeader->mModelHash = FuzzyModelHash(pModel);
+		pHeader->mNodeNum = nodeNum;
+		pHeader->mLeafNum = leafNum;
+		pHeader->mDepth = worstDepth;
+		memcpy(pHeader->mMin, context.mMin, sizeof(context.mMin));
+		memcpy(pHeader->mMax, treeMax, sizeof(treeMax));
+		pHeader->mOutMin = outMin;
+		pHeader->mOutMax = outMax;
+		pHeader->mMaxError = worstError;
+
+		memcpy(pHeader + 1, pNodes, nodeNum * sizeof(unsigned int));
+		memcpy((unsigned int *)(pHeader + 1) + nodeNum, pLeaves, 8 * leafNum * sizeof(float));
+
+		pTree->mpHeader = pHeader;
+		OctreeSetup(pTree);
+	}
+
+	free(pCells);
+	free(pNodes);
+	free(pLeaves);
+	free(context.mpErrors);
+
+	return result;
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzyOctreeEvaluate(const FuzzyOctree *pTree, const float *pInputs)
+{
+	const FuzzyOctreeHeader *pHeader = pTree->mpHeader;
+	float t[FUZZY_INPUT_NUM_MAX];
+	unsigned int node;
+	int i;
+
+	// Position in the root, in [0,1]
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		t[i] = (pInputs[i] - pHeader->mMin[i]) * pTree->mInvSize[i];
+		if (t[i] < 0.0f)
+			t[i] = 0.0f;
+		if (t[i] > 1.0f)
+			t[i] = 1.0f;
+	}
+
+	// Every level doubles the position and keeps the upper halves in the child index
+	node = pTree->mpNodes[0];
+	while ((node & FUZZY_OCTREE_LEAF) == 0)
+	{
+		unsigned int child = 0;
+
+		for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		{
+			unsigned int upper;
+
+			t[i] += t[i];
+			upper = t[i] >= 1.0f;
+			t[i] -= (float)upper;
+			child |= upper << i;
+		}
+
+		node = pTree->mpNodes[node + child];
+	}
+
+	return OctreeInterpolate(pTree->mpLeaves + 8 * (node & ~FUZZY_OCTREE_LEAF), t);
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyOctreeSave(const FuzzyOctree *pTree, const char *pFileName)
+{
+	FILE *pFile;
+	size_t bytes = FuzzyOctreeGetBytes(pTree);
+	int result;
+
+	if (bytes == 0)
+		return 0;
+
+	pFile = fopen(pFileName, "wb");
+	if (pFile == 0)
+		return 0;
+
+	result = fwrite(pTree->mpHeader, 1, bytes, pFile) == bytes;
+	return fclose(pFile) == 0 && result;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyOctreeLoad(FuzzyOctree *pTree, const char *pFileName)
+{
+	const FuzzyOctreeHeader *pHeader;
+	unsigned int bytes;
+
+	FuzzyOctreeFree(pTree);
+
+#ifdef _WIN32
+	{
+		HANDLE file, mapping;
+
+		file = CreateFileA(pFileName, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+		if (file == INVALID_HANDLE_VALUE)
+			return 0;
+
+		bytes = GetFileSize(file, 0);
+		mapping = bytes >= sizeof(FuzzyOctreeHeader) ? CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0) : 0;
+		if (mapping == 0)
+		{
+			CloseHandle(file);
+			return 0;
+		}
+
+		pHeader = (const FuzzyOctreeHeader *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (pHeader == 0)
+		{
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return 0;
+		}
+
+		pTree->mpFile = file;
+		pTree->mpMapping = mapping;
+	}
+#else
+	{
+		FILE *pFile = fopen(pFileName, "rb");
+		void *pBlock;
+		long size;
+
+		if (pFile == 0)
+			return 0;
+
+		fseek(pFile, 0, SEEK_END);
+		size = ftell(pFile);
+		fseek(pFile, 0, SEEK_SET);
+
+		pBlock = size >= (long)sizeof(FuzzyOctreeHeader) ? malloc(size) : 0;
+		if (pBlock == 0 || fread(pBlock, 1, size, pFile) != (size_t)size)
+		{
+			free(pBlock);
+			fclose(pFile);
+			return 0;
+		}
+		fclose(pFile);
+
+		bytes = (unsigned int)size;
+		pHeader = (const FuzzyOctreeHeader *)pBlock;
+	}
+#endif
+
+	pTree->mpHeader = pHeader;
+
+	// Counts bounded by the file size first, so that the size computed from them cannot wrap
+	if (memcmp(pHeader->mMagic, FUZZY_OCTREE_MAGIC, 4) != 0 || pHeader->mVersion != FUZZY_OCTREE_VERSION ||
+		pHeader->mNodeNum == 0 || pHeader->mNodeNum > bytes / sizeof(unsigned int) || pHeader->mLeafNum > bytes / (8 * sizeof(float)) ||
+		FuzzyOctreeGetBytes(pTree) != bytes)
+	{
+		FuzzyOctreeFree(pTree);
+		return 0;
+	}
+
+	OctreeSetup(pTree);
+	if (!OctreeCheckNodes(pTree))
+	{
+		FuzzyOctreeFree(pTree);
+		return 0;
+	}
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+unsigned int FuzzyOctreeGetBytes(const FuzzyOctree *pTree)
+{
+	if (pTree->mpHeader == 0)
+		return 0;
+
+	return sizeof(FuzzyOctreeHeader) + pTree->mpHeader->mNodeNum * sizeof(unsigned int) + 8 * pTree->mpHeader->mLeafNum * sizeof(float);
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyOctreeFree(FuzzyOctree *pTree)
+{
+#ifdef _WIN32
+	if (pTree->mpMapping)
+	{
+		UnmapViewOfFile(pTree->mpHeader);
+		CloseHandle((HANDLE)pTree->mpMapping);
+		CloseHandle((HANDLE)pTree->mpFile);
+	}
+	else
+#endif
+	if (pTree->mpHeader)
+	{
+		free((void *)pTree->mpHeader);
+	}
+	memset(pTree, 0, sizeof(FuzzyOctree));
+}
@@ -0,0 +1,181 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyStats.c
+Purpose:		Per rule firing statistics of a fuzzy model
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "FuzzyStats.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _MSC_VER
+#define FUZZY_STATS_THREAD_LOCAL	__declspec(thread)
+#else
+#define FUZZY_STATS_THREAD_LOCAL	__thread
+#endif
+
+// ---------------------------------------------------------------------------
+
+static FuzzyStats							*sgpFuzzyStats;
+static FUZZY_STATS_THREAD_LOCAL int			sgFuzzyStatsThread;
+
+// ---------------------------------------------------------------------------
+
+void FuzzyStatsAttach(FuzzyStats *pStats, const FuzzyModel *pModel)
+{
+	if (pStats)
+	{
+		memset(pStats, 0, sizeof(FuzzyStats));
+		pStats->mpModel = pModel;
+	}
+	sgpFuzzyStats = pStats;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyStatsSetThread(int thread)
+{
+	sgFuzzyStatsThread = thread < FUZZY_STATS_THREAD_NUM_MAX ? thread : FUZZY_STATS_THREAD_NUM_MAX - 1;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyStatsRecord(const FuzzyModel *pModel, const unsigned char *pRules, const float *pFiring, const float *pWeights, int num, float denominator)
+{
+	FuzzyStatsCounters *pCounters;
+	float invDenominator;
+	int j;
+
+	if (sgpFuzzyStats == 0 || sgpFuzzyStats->mpModel != pModel)
+	{
+		return;
+	}
+
+	pCounters = sgpFuzzyStats->mThread + sgFuzzyStatsThread;
+	pCounters->mEvaluationNum += 1.0;
+
+	if (denominator <= 0.0f)
+	{
+		pCounters->mNoFireNum += 1.0;
+		return;
+	}
+	invDenominator = 1.0f / denominator;
+
+	for (j = 0; j < num; ++j)
+	{
+		int r = pRules[j], bin;
+		float strength = pFiring[j] * invDenominator, contribution = strength * pWeights[j];
+
+		if (pFiring[j] <= 0.0f)
+			continue;
+
+		// ]0,1] in FUZZY_STATS_BIN_NUM bins, 1 in the last one
+		bin = (int)(pFiring[j] * FUZZY_STATS_BIN_NUM);
+		bin = bin < FUZZY_STATS_BIN_NUM ? bin : FUZZY_STATS_BIN_NUM - 1;
+
+		pCounters->mFireNum[r] += 1.0;
+		pCounters->mStrength[r] += strength;
+		pCounters->mContribution[r] += contribution;
+		pCounters->mContributionAbs[r] += fabsf(contribution);
+		++pCounters->mHistogram[r][bin];
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyStatsMerge(FuzzyStats *pStats)
+{
+	FuzzyStatsCounters *pTotal = &pStats->mTotal;
+	int t, r, b;
+
+	for (t = 0; t < FUZZY_STATS_THREAD_NUM_MAX; ++t)
+	{
+		FuzzyStatsCounters *pThread = pStats->mThread + t;
+
+		if (pThread->mEvaluationNum == 0.0)
+			continue;
+
+		pTotal->mEvaluationNum += pThread->mEvaluationNum;
+		pTotal->mNoFireNum += pThread->mNoFireNum;
+		for (r = 0; r < FUZZY_RULE_NUM_MAX; ++r)
+		{
+			pTotal->mFireNum[r] += pThread->mFireNum[r];
+			pTotal->mStrength[r] += pThread->mStrength[r];
+			pTotal->mContribution[r] += pThread->mContribution[r];
+			pTotal->mContributionAbs[r] += pThread->mContributionAbs[r];
+			for (b = 0; b < FUZZY_STATS_BIN_NUM; ++b)
+				pTotal->mHistogram[r][b] += pThread->mHistogram[r][b];
+		}
+
+		memset(pThread, 0, sizeof(FuzzyStatsCounters));
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyStatsSave(const FuzzyStats *pStats, const FuzzyRuleBase *pRuleBase, const char *pFileName)
+{
+	const FuzzyStatsCounters *pTotal = &pStats->mTotal;
+	FILE *pFile = fopen(pFileName, "w");
+	double contributionAbs = 0.0;
+	int r, i, o, b, deadNum = 0;
+
+	if (!pFile)
+	{
+		return -1;
+	}
+
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+		contributionAbs += pTotal->mContributionAbs[r];
+
+	fprintf(pFile, "# %.0f evaluations, %.0f without any rule firing\n", pTotal->mEvaluationNum, pTotal->mNoFireNum);
+	fprintf(pFile, "# fuzzy cache and memo hits reuse an earlier evaluation and are not counted\n");
+	fprintf(pFile, "# rule: fired (%% of evaluations), mean normalized strength when fired,\n");
+	fprintf(pFile, "# mean contribution to %s when fired, share of all |contributions|,\n", pRuleBase->mOutputName[0]);
+	fprintf(pFile, "# firing strength histogram (%d bins over ]0,1])\n", FUZZY_STATS_BIN_NUM);
+
+	for (r = 0; r < pRuleBase->mRuleNum; ++r)
+	{
+		double fireNum = pTotal->mFireNum[r];
+
+		fprintf(pFile, "%2d if", r);
+		for (i = 0; i < pRuleBase->mInputNum; ++i)
+			fprintf(pFile, "%s %s is %s", i ? " and" : "", pRuleBase->mInputName[i], pRuleBase->mInputMfName[i][pRuleBase->mRuleMf[r][i]]);
+		fprintf(pFile, " then");
+		for (o = 0; o < pRuleBase->mOutputNum; ++o)
+			fprintf(pFile, "%s %s is %s", o ? " and" : "", pRuleBase->mOutputName[o], pRuleBase->mOutputMfName[o][pRuleBase->mRuleOutput[r][o]]);
+
+		if (fireNum == 0.0)
+		{
+			fprintf(pFile, "\n   DEAD: never fired\n");
+			++deadNum;
+			continue;
+		}
+
+		fprintf(pFile, "\n   fired %6.2f%%, strength %.3f, contribution %8.2f, share %6.2f%%, histogram",
+			pTotal->mEvaluationNum > 0.0 ? 100.0 * fireNum / pTotal->mEvaluationNum : 0.0,
+			pTotal->mStrength[r] / fireNum, pTotal->mContribution[r] / fireNum,
+			contributionAbs > 0.0 ? 100.0 * pTotal->mContributionAbs[r] / contributionAbs : 0.0);
+		for (b = 0; b < FUZZY_STATS_BIN_NUM; ++b)
+			fprintf(pFile, " %u", pTotal->mHistogram[r][b]);
+		fprintf(pFile, "\n");
+	}
+
+	fprintf(pFile, "# %d dead rules\n", deadNum);
+	fclose(pFile);
+
+	return deadNum;
+}
@@ -0,0 +1,345 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzySurface.c
+Purpose:		Fuzzy control surface sampled on a grid, with trilinear interpolation
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "FuzzySurface.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+// ---------------------------------------------------------------------------
+
+int FuzzySurfaceBuild(FuzzySurface *pSurface, const FuzzyModel *pModel, const float *pMin, const float *pMax, const int *pResolution,
+	float outMin, float outMax, unsigned int discreteMask)
+{
+	float inputs[FUZZY_INPUT_NUM_MAX];
+	int index[FUZZY_INPUT_NUM_MAX];
+	int i, sample, sampleNum = 1;
+
+	FuzzySurfaceFree(pSurface);
+
+	pSurface->mOutMin = outMin;
+	pSurface->mOutMax = outMax;
+	pSurface->mDiscreteMask = discreteMask;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		if (i < pModel->mInputNum)
+		{
+			pSurface->mResolution[i] = pResolution[i] < 2 ? 2 : pResolution[i];
+			pSurface->mMin[i] = pMin[i];
+			pSurface->mMax[i] = pMax[i];
+			pSurface->mInvStep[i] = (pSurface->mResolution[i] - 1) / (pMax[i] - pMin[i]);
+		}
+		else
+		{
+			pSurface->mResolution[i] = 1;
+			pSurface->mMin[i] = pSurface->mMax[i] = 0.0f;
+			pSurface->mInvStep[i] = 0.0f;
+		}
+
+		pSurface->mStride[i] = sampleNum;
+		sampleNum *= pSurface->mResolution[i];
+	}
+
+	pSurface->mpSamples = (float *)malloc(sampleNum * sizeof(float));
+	if (pSurface->mpSamples == 0)
+		return 0;
+
+	// Walk the grid, first input fastest
+	memset(index, 0, sizeof(index));
+	for (sample = 0; sample < sampleNum; ++sample)
+	{
+		for (i = 0; i < pModel->mInputNum; ++i)
+			inputs[i] = pSurface->mMin[i] + index[i] / pSurface->mInvStep[i];
+
+		pSurface->mpSamples[sample] = FuzzySurfaceEvaluateExact(pSurface, pModel, inputs);
+
+		for (i = 0; i < FUZZY_INPUT_NUM_MAX && ++index[i] == pSurface->mResolution[i]; ++i)
+			index[i] = 0;
+	}
+
+	FuzzySurfaceMeasureError(pSurface, pModel);
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzySurfaceBuildForError(FuzzySurface *pSurface, const FuzzyModel *pModel, const float *pMin, const float *pMax,
+	const int *pResolution, float outMin, float outMax, unsigned int discreteMask, int maxResolution, float maxError)
+{
+	int resolution[FUZZY_INPUT_NUM_MAX];
+	int i, refined;
+
+	memcpy(resolution, pResolution, sizeof(resolution));
+
+	for (;;)
+	{
+		if (!FuzzySurfaceBuild(pSurface, pModel, pMin, pMax, resolution, outMin, outMax, discreteMask))
+			return 0;
+		if (pSurface->mMaxError <= maxError)
+			return 1;
+
+		// Twice as many intervals along every input that can still be refined
+		refined = 0;
+		for (i = 0; i < pModel->mInputNum; ++i)
+		{
+			int finer = 2 * resolution[i] - 1;
+
+			if ((discreteMask & (1u << i)) == 0 && finer <= maxResolution)
+			{
+				resolution[i] = finer;
+				refined = 1;
+			}
+		}
+
+		if (refined == 0)
+			return 0;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzySurfaceEvaluate(const FuzzySurface *pSurface, const float *pInputs)
+{
+	float f[FUZZY_INPUT_NUM_MAX];
+	int offset[FUZZY_INPUT_NUM_MAX];
+	const float *pCell = pSurface->mpSamples;
+	float c00, c10, c01, c11, c0, c1;
+	int i;
+
+	// Cell containing the inputs and position inside of it
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		float t = (pInputs[i] - pSurface->mMin[i]) * pSurface->mInvStep[i];
+		int last = pSurface->mResolution[i] - 2;
+		int cell;
+
+		if (last < 0)
+		{
+			// Input not used by the model
+			f[i] = 0.0f;
+			offset[i] = 0;
+			continue;
+		}
+
+		if (t < 0.0f)
+			t = 0.0f;
+		cell = (int)t;
+		if (cell > last)
+			cell = last;
+
+		f[i] = t - cell;
+		if (f[i] > 1.0f)
+			f[i] = 1.0f;
+		offset[i] = pSurface->mStride[i];
+		pCell += cell * pSurface->mStride[i];
+	}
+
+	// Interpolate along the first input, then the second, then the third
+	c00 = pCell[0] + (pCell[offset[0]] - pCell[0]) * f[0];
+	c10 = pCell[offset[1]] + (pCell[offset[1] + offset[0]] - pCell[offset[1]]) * f[0];
+	c01 = pCell[offset[2]] + (pCell[offset[2] + offset[0]] - pCell[offset[2]]) * f[0];
+	c11 = pCell[offset[2] + offset[1]] + (pCell[offset[2] + offset[1] + offset[0]] - pCell[offset[2] + offset[1]]) * f[0];
+
+	c0 = c00 + (c10 - c00) * f[1];
+	c1 = c01 + (c11 - c01) * f[1];
+
+	return c0 + (c1 - c0) * f[2];
+}
+
+// ---------------------------------------------------------------------------
+
+// Sorted insertion of a breakpoint strictly inside [lo, hi]
+static void FuzzySurfaceAddBreak(float *pBreaks, int *pBreakNum, float point, float lo, float hi)
+{
+	int b;
+
+	if (point <= lo || point >= hi)
+		return;
+	for (b = *pBreakNum; b > 0 && pBreaks[b - 1] > point; --b)
+		pBreaks[b] = pBreaks[b - 1];
+	pBreaks[b] = point;
+	++*pBreakNum;
+}
+
+// ---------------------------------------------------------------------------
+
+// Check points of input i: the samples and, unless the input is discrete,
+// every breakpoint of the model in between (feet and peaks of the membership
+// functions, where the output bends), with FUZZY_SURFACE_CHECK_NUM points
+// evenly spread between 2 of them. pPos is 0 to count them.
+// Returns the number of points
+static int FuzzySurfaceCheckPoints(const FuzzySurface *pSurface, const FuzzyModel *pModel, int i, float *pPos)
+{
+	float lo = pSurface->mMin[i], hi = pSurface->mMax[i];
+	int sampleNum = pSurface->mResolution[i];
+	int num = 0, k, m, s;
+
+	if (i >= pModel->mInputNum || (pSurface->mDiscreteMask & (1u << i)))
+	{
+		for (s = 0; s < sampleNum; ++s)
+		{
+			if (pPos)
+				pPos[num] = lo + s / pSurface->mInvStep[i];
+			++num;
+		}
+		return num;
+	}
+
+	for (s = 0; s + 1 < sampleNum; ++s)
+	{
+		float cellLo = lo + s / pSurface->mInvStep[i];
+		float cellHi = s + 2 == sampleNum ? hi : lo + (s + 1) / pSurface->mInvStep[i];
+		float breaks[FUZZY_SEGMENT_NUM_MAX + 2 * FUZZY_MF_NUM_MAX + 2];
+		int breakNum = 0, b;
+
+		// Bounds of the cell and the breakpoints inside, sorted: the feet
+		// and both ends of the peaks
+		breaks[breakNum++] = cellLo;
+		for (k = 0; k <= pModel->mSegNum[i]; ++k)
+			FuzzySurfaceAddBreak(breaks, &breakNum, pModel->mSegBound[i][k], cellLo, cellHi);
+		for (m = 0; m < pModel->mMfNum[i]; ++m)
+		{
+			if (pModel->mMfBiasL[i][m] == 0.0f && pModel->mMfInvL[i][m] > 0.0f)
+				FuzzySurfaceAddBreak(breaks, &breakNum, pModel->mMfA[i][m] + 1.0f / pModel->mMfInvL[i][m], cellLo, cellHi);
+			if (pModel->mMfBiasR[i][m] == 0.0f && pModel->mMfInvR[i][m] > 0.0f)
+				FuzzySurfaceAddBreak(breaks, &breakNum, pModel->mMfC[i][m] - 1.0f / pModel->mMfInvR[i][m], cellLo, cellHi);
+		}
+
+		for (b = 0; b < breakNum; ++b)
+		{
+			float size = (b + 1 < breakNum ? breaks[b + 1] : cellHi) - breaks[b];
+
+			for (k = 0; k <= FUZZY_SURFACE_CHECK_NUM; ++k)
+			{
+				if (pPos)
+					pPos[num] = breaks[b] + size * k / (FUZZY_SURFACE_CHECK_NUM + 1.0f);
+				++num;
+			}
+		}
+	}
+	if (pPos)
+		pPos[num] = hi;
+	return num + 1;
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzySurfaceMeasureError(FuzzySurface *pSurface, const FuzzyModel *pModel)
+{
+	float *pPos[FUZZY_INPUT_NUM_MAX];
+	float inputs[FUZZY_INPUT_NUM_MAX];
+	int index[FUZZY_INPUT_NUM_MAX], checkNum[FUZZY_INPUT_NUM_MAX], stride[FUZZY_INPUT_NUM_MAX];
+	float *pErrors;
+	float maxError = 0.0f;
+	int i, check, totalNum = 1, allocated = 1;
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+	{
+		checkNum[i] = FuzzySurfaceCheckPoints(pSurface, pModel, i, 0);
+		pPos[i] = (float *)malloc(checkNum[i] * sizeof(float));
+		if (pPos[i] == 0)
+			allocated = 0;
+		else
+			FuzzySurfaceCheckPoints(pSurface, pModel, i, pPos[i]);
+		stride[i] = totalNum;
+		totalNum *= checkNum[i];
+	}
+	pErrors = (float *)malloc(totalNum * sizeof(float));
+
+	if (allocated == 0 || pErrors == 0)
+	{
+		// Nothing measured, no error budget is met
+		maxError = FLT_MAX;
+	}
+	else
+	{
+		// Deviation on the check points
+		memset(index, 0, sizeof(index));
+		for (check = 0; check < totalNum; ++check)
+		{
+			for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+				inputs[i] = pPos[i][index[i]];
+
+			pErrors[check] = FuzzySurfaceEvaluate(pSurface, inputs) - FuzzySurfaceEvaluateExact(pSurface, pModel, inputs);
+
+			for (i = 0; i < FUZZY_INPUT_NUM_MAX && ++index[i] == checkNum[i]; ++i)
+				index[i] = 0;
+		}
+
+		// Widened by half the change of the deviation towards each neighbor
+		// along every continuous input, as in FuzzyOctreeBuild: the firing
+		// strengths are the min of the memberships, so the model also bends
+		// between the breakpoints, where 2 memberships cross
+		memset(index, 0, sizeof(index));
+		for (check = 0; check < totalNum; ++check)
+		{
+			float error = pErrors[check];
+			float bound = fabsf(error);
+
+			for (i = 0; i < pModel->mInputNum; ++i)
+			{
+				float change = 0.0f;
+
+				if (pSurface->mDiscreteMask & (1u << i))
+					continue;
+				if (index[i] > 0)
+					change = fabsf(error - pErrors[check - stride[i]]);
+				if (index[i] + 1 < checkNum[i] && fabsf(error - pErrors[check + stride[i]]) > change)
+					change = fabsf(error - pErrors[check + stride[i]]);
+				bound += 0.5f * change;
+			}
+			if (bound > maxError)
+				maxError = bound;
+
+			for (i = 0; i < FUZZY_INPUT_NUM_MAX && ++index[i] == checkNum[i]; ++i)
+				index[i] = 0;
+		}
+	}
+
+	for (i = 0; i < FUZZY_INPUT_NUM_MAX; ++i)
+		free(pPos[i]);
+	free(pErrors);
+
+	pSurface->mMaxError = maxError;
+	return maxError;
+}
+
+// ---------------------------------------------------------------------------
+
+float FuzzySurfaceEvaluateExact(const FuzzySurface *pSurface, const FuzzyModel *pModel, const float *pInputs)
+{
+	float output = FuzzyModelEvaluate(pModel, pInputs);
+
+	if (output < pSurface->mOutMin)
+		return pSurface->mOutMin;
+	if (output > pSurface->mOutMax)
+		return pSurface->mOutMax;
+	return output;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzySurfaceFree(FuzzySurface *pSurface)
+{
+	if (pSurface->mpSamples)
+	{
+		free(pSurface->mpSamples);
+	}
+	memset(pSurface, 0, sizeof(FuzzySurface));
+}
@@ -0,0 +1,456 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		FuzzyTrain.c
+Purpose:		Least squares training of the Sugeno consequents from recorded samples
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "FuzzyTrain.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+
+// ---------------------------------------------------------------------------
+
+static char sgFuzzyTrainError[256];
+
+// ---------------------------------------------------------------------------
+
+// Records the error message and returns 0, as FuzzyIOFail
+static int FuzzyTrainFail(const char *pFormat, ...)
+{
+	va_list args;
+
+	va_start(args, pFormat);
+	vsnprintf(sgFuzzyTrainError, sizeof(sgFuzzyTrainError), pFormat, args);
+	va_end(args);
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------
+
+const char *FuzzyTrainGetError(void)
+{
+	return sgFuzzyTrainError;
+}
+
+// ---------------------------------------------------------------------------
+
+// Reads the header of a dataset, returns its number of inputs or 0 if it is not a dataset
+static int FuzzyDatasetReadHeader(FILE *pFile)
+{
+	char magic[4];
+	unsigned int header[3];
+
+	if (fread(magic, 4, 1, pFile) != 1 || memcmp(magic, FUZZY_DATASET_MAGIC, 4) != 0 ||
+		fread(header, sizeof(header), 1, pFile) != 1 || header[0] != FUZZY_DATASET_VERSION ||
+		header[1] == 0 || header[1] > FUZZY_INPUT_NUM_MAX)
+	{
+		return 0;
+	}
+
+	return (int)header[1];
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyDatasetOpen(FuzzyDataset *pDataset, const char *pFileName, int inputNum)
+{
+	const long headerSize = 4 + 3 * sizeof(unsigned int);
+	const long sampleSize = (inputNum + 1) * sizeof(float);
+	FILE *pFile;
+
+	memset(pDataset, 0, sizeof(FuzzyDataset));
+	pDataset->mInputNum = inputNum;
+
+	// Appended after the last whole sample of a dataset with the same inputs
+	pFile = fopen(pFileName, "r+b");
+	if (pFile)
+	{
+		if (FuzzyDatasetReadHeader(pFile) == inputNum && fseek(pFile, 0, SEEK_END) == 0)
+		{
+			long size = ftell(pFile);
+
+			fseek(pFile, headerSize + (size - headerSize) / sampleSize * sampleSize, SEEK_SET);
+			pDataset->mpFile = pFile;
+			return 1;
+		}
+		fclose(pFile);
+	}
+
+	pFile = fopen(pFileName, "wb");
+	if (!pFile)
+	{
+		return FuzzyTrainFail("Cannot create the dataset %s", pFileName);
+	}
+
+	{
+		unsigned int header[3];
+
+		header[0] = FUZZY_DATASET_VERSION;
+		header[1] = (unsigned int)inputNum;
+		header[2] = 0;
+		fwrite(FUZZY_DATASET_MAGIC, 4, 1, pFile);
+		fwrite(header, sizeof(header), 1, pFile);
+	}
+
+	pDataset->mpFile = pFile;
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyDatasetAdd(FuzzyDataset *pDataset, const float *pInputs, float target)
+{
+	if (!pDataset->mpFile)
+	{
+		return;
+	}
+
+	fwrite(pInputs, sizeof(float), pDataset->mInputNum, (FILE *)pDataset->mpFile);
+	fwrite(&target, sizeof(float), 1, (FILE *)pDataset->mpFile);
+	++pDataset->mSampleNum;
+}
+
+// ---------------------------------------------------------------------------
+
+void FuzzyDatasetClose(FuzzyDataset *pDataset)
+{
+	if (pDataset->mpFile)
+	{
+		fclose((FILE *)pDataset->mpFile);
+	}
+	pDataset->mpFile = 0;
+}
+
+// ---------------------------------------------------------------------------
+
+// Output "output" of pModel given the rules that fire, as FuzzyModelEvaluateOutputs
+static float FuzzyTrainOutput(const FuzzyModel *pModel, int output, const float *pInputs, const unsigned char *pRules, const float *pFiring, int num)
+{
+	float y = 0.0f;
+	int i, j;
+
+	for (j = 0; j < num; ++j)
+	{
+		float w = pModel->mRuleConst[output][pRules[j]];
+
+		for (i = 0; i < pModel->mInputNum; ++i)
+			w += pModel->mRuleCoef[output][i][pRules[j]] * pInputs[i];
+		y += pFiring[j] * w;
+	}
+
+	return y;
+}
+
+// ---------------------------------------------------------------------------
+
+// Streams the samples of pFile (after its header) through the model. With
+// pA and pB set, adds every sample to the normal equations of the
+// consequents, parameter (n + 1) * rule + i being the coefficient of input
+// i (i = n: the constant). Returns the sum of squared errors of the model
+static double FuzzyTrainPass(const FuzzyModel *pModel, int output, FILE *pFile, float *pChunk, double *pA, double *pB, FuzzyTrainStats *pStats)
+{
+	const int n = pModel->mInputNum, stride = n + 1, paramNum = pModel->mRuleNum * (n + 1);
+	double error = 0.0;
+	size_t chunkNum, s;
+
+	pStats->mSampleNum = 0;
+	pStats->mSkipNum = 0;
+
+	while ((chunkNum = fread(pChunk, stride * sizeof(float), FUZZY_TRAIN_CHUNK_NUM, pFile)) > 0)
+	{
+		for (s = 0; s < chunkNum; ++s)
+		{
+			const float *pSample = pChunk + s * stride;
+			unsigned char rules[FUZZY_RULE_NUM_MAX];
+			float firing[FUZZY_RULE_NUM_MAX];
+			int index[FUZZY_TRAIN_PARAM_NUM_MAX];
+			double value[FUZZY_TRAIN_PARAM_NUM_MAX];
+			int num, nonZero = 0, i, j, k;
+			float y;
+
+			num = FuzzyModelFiring(pModel, pSample, rules, firing);
+			if (num == 0)
+			{
+				++pStats->mSkipNum;
+				continue;
+			}
+			++pStats->mSampleNum;
+
+			y = FuzzyTrainOutput(pModel, output, pSample, rules, firing, num) - pSample[n];
+			error += (double)y * y;
+
+			if (!pA)
+				continue;
+
+			// Regressors of the sample, only the parameters of the rules that fire are not 0
+			for (j = 0; j < num; ++j)
+			{
+				for (i = 0; i < n; ++i)
+				{
+					index[nonZero] = rules[j] * stride + i;
+					value[nonZero++] = (double)firing[j] * pSample[i];
+				}
+				index[nonZero] = rules[j] * stride + n;
+				value[nonZero++] = firing[j];
+			}
+
+			for (j = 0; j < nonZero; ++j)
+			{
+				double *pRow = pA + index[j] * paramNum;
+
+				for (k = 0; k < nonZero; ++k)
+					pRow[index[k]] += value[j] * value[k];
+				pB[index[j]] += value[j] * pSample[n];
+			}
+		}
+	}
+
+	return error;
+}
+
+// ---------------------------------------------------------------------------
+
+// Solves pA x = pB in place (x in pB), pA symmetric positive definite.
+// Returns 0 if pA is not
+static int FuzzyTrainCholesky(double *pA, double *pB, int num)
+{
+	int i, j, k;
+
+	// pA = L L^T, L in the lower triangle
+	for (j = 0; j < num; ++j)
+	{
+		double d = pA[j * num + j];
+
+		for (k = 0; k < j; ++k)
+			d -= pA[j * num + k] * pA[j * num + k];
+		if (d <= 0.0)
+		{
+			return 0;
+		}
+		d = sqrt(d);
+		pA[j * num + j] = d;
+
+		for (i = j + 1; i < num; ++i)
+		{
+			double sum = pA[i * num + j];
+
+			for (k = 0; k < j; ++k)
+				sum -= pA[i * num + k] * pA[j * num + k];
+			pA[i * num + j] = sum / d;
+		}
+	}
+
+	// L y = b, then L^T x = y
+	for (i = 0; i < num; ++i)
+	{
+		for (k = 0; k < i; ++k)
+			pB[i] -= pA[i * num + k] * pB[k];
+		pB[i] /= pA[i * num + i];
+	}
+	for (i = num - 1; i >= 0; --i)
+	{
+		for (k = i + 1; k < num; ++k)
+			pB[i] -= pA[k * num + i] * pB[k];
+		pB[i] /= pA[i * num + i];
+	}
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyModelTrain(FuzzyModel *pModel, int output, const char *pFileName, float ridge, FuzzyTrainStats *pStats)
+{
+	const int n = pModel->mInputNum, stride = n + 1, paramNum = pModel->mRuleNum * (n + 1);
+	const long headerSize = 4 + 3 * sizeof(unsigned int);
+	FuzzyModel trained;
+	FuzzyTrainStats stats;
+	double *pA, *pB, errorBefore, errorAfter;
+	float *pChunk;
+	FILE *pFile;
+	int i, p, r, result = 1;
+
+	if (output < 0 || output >= pModel->mOutputNum)
+	{
+		return FuzzyTrainFail("The model has no output %d", output);
+	}
+
+	pFile = fopen(pFileName, "rb");
+	if (!pFile)
+	{
+		return FuzzyTrainFail("Cannot open the dataset %s", pFileName);
+	}
+	if (FuzzyDatasetReadHeader(pFile) != n)
+	{
+		fclose(pFile);
+		return FuzzyTrainFail("%s is not a dataset of %d inputs", pFileName, n);
+	}
+
+	pA = (double *)calloc(paramNum * paramNum + paramNum, sizeof(double));
+	pChunk = (float *)malloc(FUZZY_TRAIN_CHUNK_NUM * stride * sizeof(float));
+	if (!pA || !pChunk)
+	{
+		free(pA);
+		free(pChunk);
+		fclose(pFile);
+		return FuzzyTrainFail("Out of memory");
+	}
+	pB = pA + paramNum * paramNum;
+
+	errorBefore = FuzzyTrainPass(pModel, output, pFile, pChunk, pA, pB, &stats);
+	if (stats.mSampleNum == 0)
+	{
+		result = FuzzyTrainFail("No rule fires on the samples of %s", pFileName);
+	}
+
+	// Ridge towards the compiled consequents: (A + D) x = b + D x0, D = ridge * diag(A).
+	// A parameter no sample reaches gets D = 1, so x = x0
+	if (result)
+	{
+		for (p = 0; p < paramNum; ++p)
+		{
+			double diagonal = pA[p * paramNum + p] > 0.0 ? ridge * pA[p * paramNum + p] : 1.0;
+
+			r = p / stride;
+			i = p % stride;
+			pA[p * paramNum + p] += diagonal;
+			pB[p] += diagonal * (i < n ? pModel->mRuleCoef[output][i][r] : pModel->mRuleConst[output][r]);
+		}
+
+		if (!FuzzyTrainCholesky(pA, pB, paramNum))
+		{
+			result = FuzzyTrainFail("The samples of %s do not determine the consequents, increase the ridge", pFileName);
+		}
+	}
+
+	if (result)
+	{
+		trained = *pModel;
+		for (p = 0; p < paramNum; ++p)
+		{
+			r = p / stride;
+			i = p % stride;
+			if (i < n)
+				trained.mRuleCoef[output][i][r] = (float)pB[p];
+			else
+				trained.mRuleConst[output][r] = (float)pB[p];
+		}
+
+		fseek(pFile, headerSize, SEEK_SET);
+		errorAfter = FuzzyTrainPass(&trained, output, pFile, pChunk, 0, 0, &stats);
+
+		*pModel = trained;
+		if (pStats)
+		{
+			*pStats = stats;
+			pStats->mErrorBefore = (float)sqrt(errorBefore / stats.mSampleNum);
+			pStats->mErrorAfter = (float)sqrt(errorAfter / stats.mSampleNum);
+		}
+	}
+
+	free(pA);
+	free(pChunk);
+	fclose(pFile);
+
+	return result;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyConsequentsSave(const FuzzyModel *pModel, unsigned int sourceHash, const char *pFileName)
+{
+	FILE *pFile = fopen(pFileName, "wb");
+	unsigned int header[5];
+	int o, r, i;
+
+	if (!pFile)
+	{
+		return FuzzyTrainFail("Cannot create %s", pFileName);
+	}
+
+	header[0] = FUZZY_CONSEQUENT_VERSION;
+	header[1] = sourceHash;
+	header[2] = (unsigned int)pModel->mOutputNum;
+	header[3] = (unsigned int)pModel->mRuleNum;
+	header[4] = (unsigned int)pModel->mInputNum;
+	fwrite(FUZZY_CONSEQUENT_MAGIC, 4, 1, pFile);
+	fwrite(header, sizeof(header), 1, pFile);
+
+	for (o = 0; o < pModel->mOutputNum; ++o)
+	{
+		for (r = 0; r < pModel->mRuleNum; ++r)
+		{
+			for (i = 0; i < pModel->mInputNum; ++i)
+				fwrite(&pModel->mRuleCoef[o][i][r], sizeof(float), 1, pFile);
+			fwrite(&pModel->mRuleConst[o][r], sizeof(float), 1, pFile);
+		}
+	}
+
+	fclose(pFile);
+	return 1;
+}
+
+// ---------------------------------------------------------------------------
+
+int FuzzyConsequentsLoad(FuzzyModel *pModel, const char *pFileName)
+{
+	FILE *pFile = fopen(pFileName, "rb");
+	FuzzyModel trained = *pModel;
+	unsigned int header[5];
+	char magic[4];
+	int o, r, i, result = 1, read = 1;
+
+	if (!pFile)
+	{
+		return FuzzyTrainFail("Cannot open %s", pFileName);
+	}
+
+	if (fread(magic, 4, 1, pFile) != 1 || memcmp(magic, FUZZY_CONSEQUENT_MAGIC, 4) != 0 ||
+		fread(header, sizeof(header), 1, pFile) != 1 || header[0] != FUZZY_CONSEQUENT_VERSION)
+	{
+		result = FuzzyTrainFail("%s is not a consequents file", pFileName);
+	}
+	else if (header[1] != FuzzyModelHash(pModel) || header[2] != (unsigned int)pModel->mOutputNum ||
+		header[3] != (unsigned int)pModel->mRuleNum || header[4] != (unsigned int)pModel->mInputNum)
+	{
+		result = FuzzyTrainFail("%s was trained from other rules", pFileName);
+	}
+
+	for (o = 0; result && o < pModel->mOutputNum; ++o)
+	{
+		for (r = 0; result && r < pModel->mRuleNum; ++r)
+		{
+			for (i = 0; i < pModel->mInputNum; ++i)
+				read &= fread(&trained.mRuleCoef[o][i][r], sizeof(float), 1, pFile) == 1;
+			read &= fread(&trained.mRuleConst[o][r], sizeof(float), 1, pFile) == 1;
+			if (!read)
+			{
+				result = FuzzyTrainFail("%s is truncated", pFileName);
+			}
+		}
+	}
+
+	if (result)
+	{
+		*pModel = trained;
+	}
+
+	fclose(pFile);
+	return result;
+}
@@ -18,12 +18,31 @@
 #include "Matrix2D.h"
 #include "Math2D.h"
 #include "Vector2D.h"
+#include "Fuzzy.h"
+#include "FuzzyBench.h"
+#include "FuzzyIO.h"
+#include "FuzzySurface.h"
+#include "FuzzyOctree.h"
+#include "FuzzyCache.h"
+#include "FuzzyMemo.h"
+#include "FuzzyCodegen.h"
+#include "FuzzyBotGenerated.h"
+#include "FuzzyFixed.h"
+#include "FuzzyTrain.h"
+#include "FuzzyStats.h"
+#include "BotScheduler.h"
+#include "BotLod.h"
+#include "BotPerception.h"
+#include "BotTable.h"
+#include "BotThreat.h"
+#include "BotPlan.h"
+#include "BotInfluence.h"
 #include <time.h>
 // ---------------------------------------------------------------------------
 // Defines
 
 #define SHAPE_NUM_MAX				32					// The total number of different vertex buffer (Shape)
-#define GAME_OBJ_INST_NUM_MAX		2048				// The total number of different game object instances
+#define GAME_OBJ_INST_NUM_MAX		(2048 + BOT_TABLE_BOT_NUM_MAX)	// The total number of different game object instances, one more per bot of the crowd
 
 #define TEXTURE_NUM_MAX				32					// The total number of different textures (*)
 
@@ -31,6 +50,35 @@
 #define SHIP_INITIAL_NUM			3					// Initial number of ship lives
 #define SHIP_SIZE					60.0f				// Ship size
 #define BULLET_SPEED				700.0f				// Bullet speed (m/s)
+#define PLAYER_BULLET_NUM_MAX		16					// Player bullets alive at once: a clip of 5 leaves the viewport before the 2.5 s reload
+
+#define BOT_RULE_BASE_FILE			"Data/Bot.fzy"		// Fuzzy rule base of the bot, text or compiled (see FuzzyIO.h)
+#define BOT_SURFACE_ERROR_MAX		10.0f				// Largest error of the bot's fuzzy lookup table (see FuzzySurface.h)
+#define BOT_SURFACE_RESOLUTION_MAX	513					// Largest number of lookup table samples along an input
+#define BOT_OCTREE_FILE				"Data/Bot.fzo"		// Octree lookup table of the bot, rebuilt when the rule base changes (see FuzzyOctree.h)
+#define BOT_OCTREE_DEPTH_MAX		10					// Largest number of octree subdivisions
+#define BOT_PLAYER_EPSILON			0.5f				// Smallest move of the player (fuzzy input) that re-evaluates the bot's fuzzy model
+#define BOT_MEMO_PLAYER_STEP		2.0f				// Quantization of the player input in the memo of the bot's fuzzy output (see FuzzyMemo.h)
+#define BOT_MEMO_ENTRY_NUM			4096				// Entries of the memo (16 bytes each)
+#define BOT_GENERATED_FILE			"src/FuzzyBotGenerated.c"	// Unrolled evaluator of the bot's rule base, written when built with FUZZY_GENERATE
+#define BOT_DATASET_FILE			"Data/Bot.fzd"		// Recorded play, the bot steered with W/S (see FuzzyTrain.h)
+#define BOT_CONSEQUENT_FILE			"Data/Bot.fzc"		// Consequents trained from the recorded play ("-train" command line)
+#define BOT_STATS_FILE				"Data/BotStats.txt"	// Rule statistics of the session, written when built with FUZZY_STATS
+#define BOT_DECISION_RATE			15.0f				// Decisions (FindPlayer and getFuzzyOutputY) per second of every bot
+#define BOT_DECISION_BUDGET			500.0				// Microseconds of bot decisions per frame, the bots left wait for the next frame
+#define BOT_CROWD_STEP				256					// Bots added by 'N'
+#define BOT_CROWD_SPACING			80.0f				// Distance between 2 bots added, along x
+#define BOT_HUD_NUM_MAX				16					// Bots drawn with their lives and ammo, the HUD of a crowd would hide it
+#define BOT_DODGE_FILE				"Data/BotDodge.fzy"	// Fuzzy dodging of the player's bullets, from the bot's threats (see BotThreat.h)
+#define BOT_THREAT_CELL_SIZE		64.0f				// Cells of the grid of the player's bullet paths
+#define BOT_THREAT_RADIUS			(0.5f * SHIP_SIZE + 10.0f)	// Distance of a bullet path that is a threat to a bot
+#define BOT_THREAT_HORIZON			0.5f				// Seconds of bullet paths looked ahead
+#define BOT_INFLUENCE_CELL_SIZE		25.0f				// Cells of the map of danger and opportunity (see BotInfluence.h)
+#define BOT_INFLUENCE_DECAY			0.9f				// Factor of the map per frame, about a third of a second of memory at 60 frames per second
+#define BOT_INFLUENCE_SPREAD		0.7f				// Factor of the map from a cell to its neighbors per frame
+#define BOT_INFLUENCE_FIRE_DANGER	0.5f				// Danger of the player's line of fire while it has ammo, a bullet is 1
+#define BOT_INFLUENCE_FIRE_RADIUS	(0.5f * SHIP_SIZE)	// Half width of the line of fire
+#define BOT_INFLUENCE_OPPORTUNITY_RADIUS	(2.0f * SHIP_SIZE)	// Half width of the band the bot can hit the player from
 
 // ---------------------------------------------------------------------------
 // ---------------------------------------------------------------------------
@@ -132,11 +180,10 @@ static unsigned long			sgGameObjectInstanceNum;								// The number of active g
 
 // pointer ot the ship object
 static GameObjectInstance*		sgpShip;												// Pointer to the "Ship" game object instance
-static GameObjectInstance*		sgpBot;													// Pointer to the "Bot"
+static GameObjectInstance*		sgpBots[BOT_TABLE_BOT_NUM_MAX];							// "Bot" of every bot of sgBotTable
 
 // number of ship available (lives 0 = game over)
 static int						sgShipLives;											// The number of lives left
-static int						sgBotLives;
 
 // the score = number of asteroid destroyed
 static unsigned long			sgPlayerScore;												// Current score
@@ -164,14 +211,19 @@ static void RemoveComponent_Target(GameObjectInstance *pInst);
 
 static float ShipX = 0.0f;
 static float ShipY = -150.0f;
-static float BotX = 0.0f;
-static float BotY = 150.0f;
 static float PlayerCHP = 100.0f;
-static float BotCHP = 100.0f;
 static int PlayerCAmmo = 5;
-static int BotCAmmo = 5;
-static float toMoveX = 0.0f;
-static float toMoveY = 0.0f;
+
+// Source of getFuzzyOutputY ('L' cycles)
+enum BOT_LOOKUP
+{
+	BOT_LOOKUP_EXACT = 0,
+	BOT_LOOKUP_SURFACE,
+	BOT_LOOKUP_OCTREE,
+	BOT_LOOKUP_MEMO,
+	BOT_LOOKUP_GENERATED,
+	BOT_LOOKUP_NUM
+};
 
 enum Textures {
 	LIVES = 1,
@@ -183,10 +235,44 @@ static AEGfxVertexList*			Lives;
 static AEGfxVertexList*			Ammo;
 
 static float FindPlayer(Vector2D DirVec, Vector2D BotVec);
-static float getFuzzyOutputY(float BotHP, float BotAmmo, float PlayerPos);
-static float Triangle(float a, float b, float c, float x);
-
-static double timerP, timerB;
+static float getFuzzyOutputY(float BotHP, float BotAmmo, float PlayerPos, int lookup, FuzzyCache *pCache);
+static void BotDecide(void *pContext, int agent);
+static int BotSpawn(float x, float y);
+static void BotPlanSnapshot(BotSimWorld *pWorld);
+static void BotRuleBaseDefault(FuzzyRuleBase *pRuleBase);
+
+static FuzzyRuleBase			sgBotRuleBase;											// Rule base of the bot, as designed
+static FuzzyModel				sgBotFuzzyModel;										// Compiled form of sgBotRuleBase, used every frame
+static FuzzySurface				sgBotFuzzySurface;										// Lookup table of getFuzzyOutputY
+static FuzzyOctree				sgBotFuzzyOctree;										// Adaptive lookup table of getFuzzyOutputY
+static FuzzyMemo				sgBotFuzzyMemo;											// Memo of getFuzzyOutputY on quantized inputs
+static FuzzyFixedModel			sgBotFuzzyFixed;										// Fixed point form of sgBotFuzzyModel
+static int						sgBotFixed;												// 1: FindPlayer, dodging and getFuzzyOutputY in fixed point, the same on every machine ('X' toggles)
+static unsigned int				sgBotFixedDecisionNum;									// Outputs of getFuzzyOutputY in fixed point, past the bots' caches and the lookup tables
+static int						sgBotLookup;											// From BOT_LOOKUP enum
+static int						sgBotMamdani[BOT_LOD_NUM];								// 1: bots at this level decide on the Mamdani centroid of the rules, not their Sugeno form ('M' toggles the near and mid levels)
+static FuzzyDataset				sgBotDataset;											// Open while recording ('R' toggles)
+static BotTable					sgBotTable;												// State of every bot, sgpBots and the agents of sgBotScheduler in the same order
+static BotScheduler				sgBotScheduler;											// Rate of the bots' decisions (BotDecide)
+static BotLod					sgBotLod;												// Level of detail of the bots' decisions
+static BotPerception			sgBotPerception;										// What the bots perceive of the ship this frame
+static FuzzyModel				sgBotDodgeModel;										// Dodging from the threat of a bot to an x offset and a chase weight, no inputs if not loaded
+static FuzzyFixedModel			sgBotDodgeFixed;										// Fixed point form of sgBotDodgeModel
+static BotThreatGrid			sgBotThreatGrid;										// Paths of the player bullets, the threats of the bots' decisions
+static BotInfluence				sgBotInfluence;											// Recent danger and opportunity around the bots, the third input of sgBotDodgeModel
+static float					sgBotSideX[2][BOT_TABLE_BOT_NUM_MAX];					// One influence cell left and right of every bot
+static float					sgBotSideInfluence[BOT_INFLUENCE_NUM][2][BOT_TABLE_BOT_NUM_MAX];	// sgBotInfluence there this frame, read by BotDecide
+static BotPlan					sgBotPlan;												// Lookahead of the first bot's height
+static int						sgBotPlanning;											// 1: the first bot's height is planned by rollouts too ('P' toggles)
+static GameObjectInstance*		sgpPlayerBullets[PLAYER_BULLET_NUM_MAX];				// Player bullets of this frame, tested against every bot
+static float					sgPlayerBulletX[PLAYER_BULLET_NUM_MAX], sgPlayerBulletY[PLAYER_BULLET_NUM_MAX];	// and their positions and velocities
+static float					sgPlayerBulletVelocityX[PLAYER_BULLET_NUM_MAX], sgPlayerBulletVelocityY[PLAYER_BULLET_NUM_MAX];
+static int						sgPlayerBulletNum;
+#ifdef FUZZY_STATS
+static FuzzyStats				sgBotFuzzyStats;										// Firing of every rule of sgBotFuzzyModel this session
+#endif
+
+static double timerP;
 
 // --------------------------------------------------------------------------
 
@@ -200,13 +286,16 @@ void GameStateAsteroidsLoad(void)
 	// No shapes at this point
 	sgShapeNum = 0;
 
-	//Zero the textures array
+	FuzzySurfaceFree(&sgBotFuzzySurface);
+	FuzzyOctreeFree(&sgBotFuzzyOctree);
+	FuzzyMemoFree(&sgBotFuzzyMemo);
+//Zero the textures array
 	memset(sgTextures, 0, sizeof(AEGfxTexture*) * TEXTURE_NUM_MAX);
 
 
 	// The ship object instance hasn't been created yet, so this "sgpShip" pointer is initialized to 0
 	sgpShip = 0;
-	sgpBot = 0;
+	memset(sgpBots, 0, sizeof(sgpBots));
 
 	// Create the game objects(shapes) : Ships, Bullet, Asteroid and Missile
 	// How to:
@@ -314,6 +403,126 @@ void GameStateAsteroidsLoad(void)
 
 	Ammo = AEGfxMeshEnd();
 	sgTextures[AMMO] = AEGfxTextureLoad("Textures/bullet.png");
+
+	// Build the bot's fuzzy model once, only the memberships and the
+	// weighted average are left to compute every frame
+	if (!FuzzyRuleBaseLoad(&sgBotRuleBase, BOT_RULE_BASE_FILE))
+	{
+		AESysPrintf("%s\nUsing the built-in rule base\n", FuzzyIOGetError());
+		BotRuleBaseDefault(&sgBotRuleBase);
+	}
+	else if (sgBotRuleBase.mInputNum != 3 || sgBotRuleBase.mOutputNum != 1)
+	{
+		AESysPrintf("%s needs 3 inputs (HP, ammo, player Y) and 1 output (bot Y)\nUsing the built-in rule base\n", BOT_RULE_BASE_FILE);
+		BotRuleBaseDefault(&sgBotRuleBase);
+	}
+	FuzzyModelCompile(&sgBotFuzzyModel, &sgBotRuleBase);
+
+	// Rollout threads, idle until planning is turned on
+	{
+		BotPlanSettings planSettings;
+
+		BotPlanDefaultSettings(&planSettings, SHIP_SIZE, 300.0f - SHIP_SIZE);
+		if (!BotPlanInit(&sgBotPlan, &planSettings))
+			AESysPrintf("Bot planning threads could not be created, planning on the main thread\n");
+	}
+
+	// Dodging, a system of its own as the bot's rule base has no input left
+	{
+		FuzzyRuleBase dodgeRuleBase;
+
+		memset(&sgBotDodgeModel, 0, sizeof(FuzzyModel));
+		if (!FuzzyRuleBaseLoad(&dodgeRuleBase, BOT_DODGE_FILE))
+			AESysPrintf("%s\nThe bot does not dodge\n", FuzzyIOGetError());
+		else if (dodgeRuleBase.mInputNum != 3 || dodgeRuleBase.mOutputNum != 2)
+			AESysPrintf("%s needs 3 inputs (time to impact, escape, influence) and 2 outputs (x offset, chase weight)\nThe bot does not dodge\n", BOT_DODGE_FILE);
+		else
+			FuzzyModelCompile(&sgBotDodgeModel, &dodgeRuleBase);
+		FuzzyFixedModelCompile(&sgBotDodgeFixed, &sgBotDodgeModel);
+	}
+
+	// Consequents fitted to recorded play replace the compiled ones, before anything is derived from the model
+	if (FuzzyConsequentsLoad(&sgBotFuzzyModel, BOT_CONSEQUENT_FILE))
+	{
+		AESysPrintf("Bot consequents trained from recorded play (%s)\n", BOT_CONSEQUENT_FILE);
+	}
+
+	FuzzyFixedModelCompile(&sgBotFuzzyFixed, &sgBotFuzzyModel);
+
+	// The generated evaluator is only used if it was generated from these rules
+#ifdef FUZZY_GENERATE
+	if (!FuzzyModelGenerate(&sgBotFuzzyModel, "FuzzyBotEvaluate", "FuzzyBotGenerated.h", BOT_GENERATED_FILE))
+	{
+		AESysPrintf("Fuzzy evaluator could not be written to %s\n", BOT_GENERATED_FILE);
+	}
+	else
+	{
+		AESysPrintf("Fuzzy evaluator written to %s, rebuild to use it\n", BOT_GENERATED_FILE);
+	}
+#else
+	if (FuzzyBotEvaluateHash() != FuzzyModelHash(&sgBotFuzzyModel))
+	{
+		AESysPrintf("%s was generated from other rules, build with FUZZY_GENERATE defined to update it\n", BOT_GENERATED_FILE);
+	}
+#endif
+
+	// HP and ammo rounded to integers, only one thread uses it
+	{
+		float step[3] = { 1.0f, 1.0f, BOT_MEMO_PLAYER_STEP };
+
+		if (!FuzzyMemoInit(&sgBotFuzzyMemo, &sgBotFuzzyModel, step, SHIP_SIZE, 300.0f - SHIP_SIZE, BOT_MEMO_ENTRY_NUM, 1))
+		{
+			AESysPrintf("Fuzzy memo could not be allocated\n");
+		}
+	}
+
+	// Lookup table of the same output: HP in [0,100], ammo in {0..5}, |player Y| in [0,300]
+	{
+		float surfaceMin[3] = { 0.0f, 0.0f, 0.0f };
+		float surfaceMax[3] = { 100.0f, 5.0f, 300.0f };
+		int surfaceResolution[3] = { 5, 6, 7 };
+
+		if (!FuzzySurfaceBuildForError(&sgBotFuzzySurface, &sgBotFuzzyModel, surfaceMin, surfaceMax, surfaceResolution,
+			SHIP_SIZE, 300.0f - SHIP_SIZE, 1u << 1, BOT_SURFACE_RESOLUTION_MAX, BOT_SURFACE_ERROR_MAX))
+		{
+			AESysPrintf("Fuzzy lookup table does not fit the error budget of %g\n", BOT_SURFACE_ERROR_MAX);
+		}
+		AESysPrintf("Fuzzy lookup table: %d x %d x %d samples, %d bytes, error bound %g\n",
+			sgBotFuzzySurface.mResolution[0], sgBotFuzzySurface.mResolution[1], sgBotFuzzySurface.mResolution[2],
+			(int)(sgBotFuzzySurface.mResolution[0] * sgBotFuzzySurface.mResolution[1] * sgBotFuzzySurface.mResolution[2] * sizeof(float)),
+			sgBotFuzzySurface.mMaxError);
+
+		// Same error budget, refined only where the output bends. Mapped from
+		// disk when it was built from this rule base, otherwise rebuilt and saved
+		if (!FuzzyOctreeLoad(&sgBotFuzzyOctree, BOT_OCTREE_FILE) ||
+			sgBotFuzzyOctree.mpHeader->mModelHash != FuzzyModelHash(&sgBotFuzzyModel))
+		{
+			if (!FuzzyOctreeBuild(&sgBotFuzzyOctree, &sgBotFuzzyModel, surfaceMin, surfaceMax,
+				SHIP_SIZE, 300.0f - SHIP_SIZE, 1u << 1, BOT_SURFACE_ERROR_MAX, BOT_OCTREE_DEPTH_MAX))
+			{
+				AESysPrintf("Fuzzy octree could not be built\n");
+			}
+			else if (!FuzzyOctreeSave(&sgBotFuzzyOctree, BOT_OCTREE_FILE))
+			{
+				AESysPrintf("Fuzzy octree could not be saved to %s\n", BOT_OCTREE_FILE);
+			}
+		}
+		if (sgBotFuzzyOctree.mpHeader)
+		{
+			AESysPrintf("Fuzzy octree: %u nodes, %u leaves, depth %u, %u bytes, max error %g\n",
+				sgBotFuzzyOctree.mpHeader->mNodeNum, sgBotFuzzyOctree.mpHeader->mLeafNum, sgBotFuzzyOctree.mpHeader->mDepth,
+				FuzzyOctreeGetBytes(&sgBotFuzzyOctree), sgBotFuzzyOctree.mpHeader->mMaxError);
+		}
+	}
+
+#ifdef FUZZY_BENCH
+	FuzzyBenchRun(&sgBotRuleBase, &sgBotFuzzyModel, &sgBotFuzzySurface, sgBotFuzzyOctree.mpHeader ? &sgBotFuzzyOctree : 0);
+#endif
+
+	// Only the game's evaluations are counted, the benchmark's are not
+#ifdef FUZZY_STATS
+	FuzzyStatsAttach(&sgBotFuzzyStats, &sgBotFuzzyModel);
+#endif
 }
 
 // ---------------------------------------------------------------------------
@@ -331,7 +540,6 @@ void GameStateAsteroidsInit(void)
 
 	//timers
 	timerP = 0.0f;
-	timerB = 0.0f;
 
 	// create the player ship
 	sgpShip = GameObjectInstanceCreate(OBJECT_TYPE_SHIP);
@@ -349,24 +557,22 @@ void GameStateAsteroidsInit(void)
 		//Vector2DSet(&PlayerAmmo[i]->mpComponent_Transform->mPosition, ShipX + 40.0f, ShipY + (25 - i * 12));
 	}
 	
-	// create the Bot ship
-	sgpBot = GameObjectInstanceCreate(OBJECT_TYPE_BOT);
-	sgpBot->mpComponent_Transform->mScaleX = SHIP_SIZE;
-	sgpBot->mpComponent_Transform->mScaleY = SHIP_SIZE;
-	sgpBot->mpComponent_Transform->mAngle = -PI / 2;
-	Vector2DSet(&sgpBot->mpComponent_Transform->mPosition, BotX, BotY);
-	// Create Bot HP and Ammo
-	for (int i = 0; i < 4; i++)
+	// create the Bot ship, the first of the crowd added with 'N'
+	BotTableInit(&sgBotTable, SHIP_SIZE, 300.0f - SHIP_SIZE);
+	BotSchedulerInit(&sgBotScheduler, 0, BOT_DECISION_RATE, BOT_DECISION_BUDGET);
 	{
-		//Vector2DSet(&BotHP[i]->mpComponent_Transform->mPosition, BotX + (-22 + i * 15), BotY + 40.0f);
-	}
-	for (int i = 0; i < 5; i++)
-	{
-		//Vector2DSet(&BotAmmo[i]->mpComponent_Transform->mPosition, BotX - 40.0f, BotY + (25 - i * 12));
+		BotLodSettings lodSettings;
+
+		BotLodDefaultSettings(&lodSettings);
+		BotLodInit(&sgBotLod, &lodSettings);
 	}
+	sgBotFixedDecisionNum = 0;
+	BotSpawn(0.0f, 150.0f);
+	BotThreatGridInit(&sgBotThreatGrid, BOT_THREAT_CELL_SIZE, BOT_THREAT_RADIUS, BOT_THREAT_HORIZON);
+	BotInfluenceInit(&sgBotInfluence, AEGfxGetWinMinX(), AEGfxGetWinMinY(), AEGfxGetWinMaxX(), AEGfxGetWinMaxY(),
+		BOT_INFLUENCE_CELL_SIZE, BOT_INFLUENCE_DECAY, BOT_INFLUENCE_SPREAD);
 
 	sgShipLives = 4;
-	sgBotLives = 4;
 
 	sgBotScore = 0;
 	sgPlayerScore = 0;
@@ -396,7 +602,6 @@ void GameStateAsteroidsUpdate(void)
 
 	frameTime = AEFrameRateControllerGetFrameTime();
 	timerP += frameTime;
-	timerB += frameTime;
 
 	// =========================
 	// Update according to input
@@ -491,37 +696,103 @@ void GameStateAsteroidsUpdate(void)
 	{
 		PlayerCAmmo = 5;
 	}
-	if (timerB > 2.5f && BotCAmmo == 0)
+	BotTableReload(&sgBotTable, (float)frameTime);
+	
+	if (AEInputCheckTriggered('L'))
+	{
+		static const char *lookupNames[BOT_LOOKUP_NUM] = { "exact", "lookup table", "octree", "memo", "generated" };
+
+		sgBotLookup = (sgBotLookup + 1) % BOT_LOOKUP_NUM;
+		if (sgBotLookup == BOT_LOOKUP_OCTREE && sgBotFuzzyOctree.mpHeader == 0)
+			sgBotLookup = BOT_LOOKUP_MEMO;
+		if (sgBotLookup == BOT_LOOKUP_MEMO && sgBotFuzzyMemo.mShardNum == 0)
+			sgBotLookup = BOT_LOOKUP_GENERATED;
+		if (sgBotLookup == BOT_LOOKUP_GENERATED && FuzzyBotEvaluateHash() != FuzzyModelHash(&sgBotFuzzyModel))
+			sgBotLookup = BOT_LOOKUP_EXACT;
+		AESysPrintf("Bot fuzzy output: %s\n", lookupNames[sgBotLookup]);
+	}
+
+	if (AEInputCheckTriggered('M'))
 	{
-		BotCAmmo = 5;
+		// Far bots keep the lookup tables, they sample the Sugeno form
+		sgBotMamdani[BOT_LOD_NEAR] = sgBotMamdani[BOT_LOD_MID] = !sgBotMamdani[BOT_LOD_NEAR];
+		AESysPrintf("Bot defuzzification of near and mid bots: %s\n", sgBotMamdani[BOT_LOD_NEAR] ? "Mamdani centroid" : "Sugeno");
 	}
-	
+
+	if (AEInputCheckTriggered('R'))
+	{
+		if (sgBotDataset.mpFile)
+		{
+			AESysPrintf("Recording stopped, %u samples added to %s\n", sgBotDataset.mSampleNum, BOT_DATASET_FILE);
+			FuzzyDatasetClose(&sgBotDataset);
+		}
+		else if (FuzzyDatasetOpen(&sgBotDataset, BOT_DATASET_FILE, 3))
+		{
+			AESysPrintf("Recording to %s, steer the bot with W/S\n", BOT_DATASET_FILE);
+		}
+		else
+		{
+			AESysPrintf("%s\n", FuzzyTrainGetError());
+		}
+	}
+
+	if (AEInputCheckTriggered('P'))
+	{
+		sgBotPlanning = !sgBotPlanning;
+		AESysPrintf("Bot planning: %s\n", sgBotPlanning ? "on" : "off");
+	}
+
+	if (AEInputCheckTriggered('X'))
+	{
+		sgBotFixed = !sgBotFixed;
+		AESysPrintf("Bot fuzzy logic: %s\n", sgBotFixed ? "fixed point, without the fuzzy caches and lookup tables" : "floating point");
+	}
+
+	if (AEInputCheckTriggered('N'))
+	{
+		int n;
+
+		for (n = 0; n < BOT_CROWD_STEP; ++n)
+		{
+			// Alternately right and left of the first bot, further each time
+			int b = sgBotTable.mBotNum;
+			float x = BOT_CROWD_SPACING * (float)((b + 1) / 2) * ((b & 1) ? 1.0f : -1.0f);
+
+			if (BotSpawn(x, 150.0f) < 0)
+				break;
+		}
+		AESysPrintf("Bots: %d\n", sgBotTable.mBotNum);
+	}
+
 	if (AEInputCheckTriggered('B'))
 	{
-		if (BotCAmmo > 0)
+		int b;
+
+		// Every bot with ammo fires
+		for (b = 0; b < sgBotTable.mBotNum; ++b)
 		{
-			GameObjectInstance *bullet = GameObjectInstanceCreate(OBJECT_TYPE_BOT_BULLET);
+			GameObjectInstance *bullet;
+
+			if (sgBotTable.mAmmo[b] == 0)
+				continue;
+
+			bullet = GameObjectInstanceCreate(OBJECT_TYPE_BOT_BULLET);
+			if (bullet == 0)
+				break;
+			BotTableFire(&sgBotTable, b);
 
 			//Bullet position
-			Vector2DSet(&bullet->mpComponent_Transform->mPosition, sgpBot->mpComponent_Transform->mPosition.x,
-				sgpBot->mpComponent_Transform->mPosition.y);
+			Vector2DSet(&bullet->mpComponent_Transform->mPosition, sgBotTable.mX[b], sgBotTable.mY[b]);
 			//Bullet angle
-			bullet->mpComponent_Transform->mAngle = sgpBot->mpComponent_Transform->mAngle;
+			bullet->mpComponent_Transform->mAngle = sgpBots[b]->mpComponent_Transform->mAngle;
 
 			//Bullet scale
 			bullet->mpComponent_Transform->mScaleX = 10.0;
 			bullet->mpComponent_Transform->mScaleY = 10.0;
 
 			//Bullet velocity
-			Vector2DSet(&bullet->mpComponent_Physics->mVelocity, cosf(sgpBot->mpComponent_Transform->mAngle) * BULLET_SPEED,
-				sinf(sgpBot->mpComponent_Transform->mAngle) * BULLET_SPEED);
-			
-			BotCAmmo--;
-			
-			if (BotCAmmo == 0)
-			{
-				timerB = 0.0f;
-			}
+			Vector2DSet(&bullet->mpComponent_Physics->mVelocity, sgBotTable.mForwardX[b] * BULLET_SPEED,
+				sgBotTable.mForwardY[b] * BULLET_SPEED);
 		}
 	}
 
@@ -544,6 +815,82 @@ void GameStateAsteroidsUpdate(void)
 		Vector2DScaleAdd(&pInst->mpComponent_Transform->mPosition, &pInst->mpComponent_Physics->mVelocity, &pInst->mpComponent_Transform->mPosition, (float)frameTime);
 	}
 
+	// Perception of the ship, then level of detail of every bot: its distance
+	// to the player, and how far it is out of the viewport
+	{
+		int b;
+
+		BotPerceptionUpdate(&sgBotPerception, sgBotTable.mX, sgBotTable.mY, sgBotTable.mForwardX, sgBotTable.mForwardY, sgBotTable.mBotNum,
+			&sgpShip->mpComponent_Transform->mPosition.x, &sgpShip->mpComponent_Transform->mPosition.y, 1);
+
+		BotLodBeginFrame(&sgBotLod);
+		for (b = 0; b < sgBotTable.mBotNum; ++b)
+		{
+			float outsideX = max(winMinX - sgBotTable.mX[b], sgBotTable.mX[b] - winMaxX);
+			float outsideY = max(winMinY - sgBotTable.mY[b], sgBotTable.mY[b] - winMaxY);
+
+			BotLodUpdate(&sgBotLod, &sgBotScheduler, b, sgBotPerception.mDistance[0][b], max(outsideX, outsideY));
+		}
+	}
+
+	// Player bullets of this frame, and the grid of their paths the bots' decisions query
+	sgPlayerBulletNum = 0;
+	for (i = 0; i < GAME_OBJ_INST_NUM_MAX && sgPlayerBulletNum < PLAYER_BULLET_NUM_MAX; i++)
+	{
+		GameObjectInstance* pInst = sgGameObjectInstanceList + i;
+		int k;
+
+		if ((pInst->mFlag & FLAG_ACTIVE) == 0 || pInst->mpComponent_Sprite->mpShape->mType != OBJECT_TYPE_PLAYER_BULLET)
+			continue;
+
+		k = sgPlayerBulletNum++;
+		sgpPlayerBullets[k] = pInst;
+		sgPlayerBulletX[k] = pInst->mpComponent_Transform->mPosition.x;
+		sgPlayerBulletY[k] = pInst->mpComponent_Transform->mPosition.y;
+		sgPlayerBulletVelocityX[k] = pInst->mpComponent_Physics->mVelocity.x;
+		sgPlayerBulletVelocityY[k] = pInst->mpComponent_Physics->mVelocity.y;
+	}
+	BotThreatGridBuild(&sgBotThreatGrid, winMinX, winMinY, winMaxX, winMaxY, sgPlayerBulletX, sgPlayerBulletY,
+		sgPlayerBulletVelocityX, sgPlayerBulletVelocityY, sgPlayerBulletNum);
+
+	// Influence map: the last frames fade and spread, then what moved this frame on top, the bullets
+	// over the path they flew and the player's line of fire, dangerous only if it can shoot
+	BotInfluenceUpdate(&sgBotInfluence);
+	for (i = 0; i < sgPlayerBulletNum; ++i)
+	{
+		BotInfluenceStamp(&sgBotInfluence, BOT_INFLUENCE_DANGER,
+			sgPlayerBulletX[i] - sgPlayerBulletVelocityX[i] * (float)frameTime, sgPlayerBulletY[i] - sgPlayerBulletVelocityY[i] * (float)frameTime,
+			sgPlayerBulletX[i], sgPlayerBulletY[i], BOT_THREAT_RADIUS, 1.0f);
+	}
+	{
+		float fireX = sgpShip->mpComponent_Transform->mPosition.x, fireY = sgpShip->mpComponent_Transform->mPosition.y;
+		float range = winMaxY - winMinY;
+		float fireEndX = fireX + cosf(sgpShip->mpComponent_Transform->mAngle) * range;
+		float fireEndY = fireY + sinf(sgpShip->mpComponent_Transform->mAngle) * range;
+
+		if (PlayerCAmmo > 0)
+			BotInfluenceStamp(&sgBotInfluence, BOT_INFLUENCE_DANGER, fireX, fireY, fireEndX, fireEndY, BOT_INFLUENCE_FIRE_RADIUS, BOT_INFLUENCE_FIRE_DANGER);
+		BotInfluenceStamp(&sgBotInfluence, BOT_INFLUENCE_OPPORTUNITY, fireX, fireY, fireEndX, fireEndY, BOT_INFLUENCE_OPPORTUNITY_RADIUS, 1.0f);
+	}
+
+	// Influences on both sides of every bot, in one pass per layer and side for the decisions below
+	if (sgBotDodgeModel.mInputNum)
+	{
+		int b, side, layer;
+
+		for (b = 0; b < sgBotTable.mBotNum; ++b)
+		{
+			sgBotSideX[0][b] = sgBotTable.mX[b] - BOT_INFLUENCE_CELL_SIZE;
+			sgBotSideX[1][b] = sgBotTable.mX[b] + BOT_INFLUENCE_CELL_SIZE;
+		}
+		for (layer = 0; layer < BOT_INFLUENCE_NUM; ++layer)
+			for (side = 0; side < 2; ++side)
+				BotInfluenceSampleBatch(&sgBotInfluence, layer, sgBotSideX[side], sgBotTable.mY, sgBotTable.mBotNum, sgBotSideInfluence[layer][side]);
+	}
+
+	// Bot decisions due this frame, the bots move toward them below
+	BotSchedulerUpdate(&sgBotScheduler, (float)frameTime, BotDecide, 0);
+
 	/////////////////////////////////////////////////////////////////////////////////////////////////
 	/////////////////////////////////////////////////////////////////////////////////////////////////
 	// TO DO 9: Check for collision
@@ -597,80 +944,6 @@ void GameStateAsteroidsUpdate(void)
 			}
 		}
 	
-		if (pInst->mpComponent_Sprite->mpShape->mType == OBJECT_TYPE_BOT) {
-
-			int j;
-			for (j = 0; j < GAME_OBJ_INST_NUM_MAX; j++) {
-
-				GameObjectInstance* pjInst = sgGameObjectInstanceList + j;
-
-				if ((pjInst->mFlag & FLAG_ACTIVE) == 0)
-					continue;
-
-			
-				if (pjInst->mpComponent_Sprite->mpShape->mType == OBJECT_TYPE_PLAYER_BULLET) {
-					if (pInst->mFlag != 0) {
-						if (StaticPointToStaticRect(
-							&pjInst->mpComponent_Transform->mPosition,
-							&pInst->mpComponent_Transform->mPosition,
-							pInst->mpComponent_Transform->mScaleX,
-							pInst->mpComponent_Transform->mScaleY) == 1) {
-							GameObjectInstanceDestroy(pjInst);
-							sgBotLives = ((int)(BotCHP / 25) + 1) > 4 ? 4 : ((int)(BotCHP / 25) + 1);
-							BotCHP -= 8.0f;
-							if (BotCHP < 0.0f)
-							{
-								BotCHP = 100.0f;
-								sgPlayerScore++;
-								sgBotLives = 4;
-								AESysPrintf("PlayerScore = %d | BotScore = %d\n", sgPlayerScore, sgBotScore);
-							}
-						}
-					}
-				}
-			}
-
-			{
-				Vector2D DirectionVec, BotVec;
-				Vector2DSub(&DirectionVec, &sgpShip->mpComponent_Transform->mPosition, &sgpBot->mpComponent_Transform->mPosition);
-				Vector2DSet(&BotVec, cosf(sgpBot->mpComponent_Transform->mAngle), sinf(sgpBot->mpComponent_Transform->mAngle));
-				toMoveX = FindPlayer(DirectionVec, BotVec);
-			}
-			
-			toMoveY = getFuzzyOutputY(BotCHP, (float)BotCAmmo, fabs(sgpShip->mpComponent_Transform->mPosition.y));
-			
-			if (toMoveX > 3.5f)
-			{
-				sgpBot->mpComponent_Transform->mPosition.x += 3.5f;
-				BotX = sgpBot->mpComponent_Transform->mPosition.x;
-				toMoveX -= 3.5f;
-			}
-			else if(toMoveX < -3.5f)
-			{
-				sgpBot->mpComponent_Transform->mPosition.x -= 3.5f;
-				BotX = sgpBot->mpComponent_Transform->mPosition.x;
-				toMoveX -= 3.5f;
-			}
-
-			if ((toMoveY - BotY) > 1.75f)
-			{
-				sgpBot->mpComponent_Transform->mPosition.y += 3.5f;
-				BotY = sgpBot->mpComponent_Transform->mPosition.y;
-				toMoveY -= 3.5f;
-			}
-			else if ((toMoveY-BotY) < -1.75f)
-			{
-				sgpBot->mpComponent_Transform->mPosition.y -= 3.5f;
-				BotY = sgpBot->mpComponent_Transform->mPosition.y;
-				toMoveY -= 3.5f;
-			}
-			else
-			{
-				sgpBot->mpComponent_Transform->mPosition.y = toMoveY;
-				BotY = sgpBot->mpComponent_Transform->mPosition.y;
-			}
-		}
-
 		if (pInst->mpComponent_Sprite->mpShape->mType == OBJECT_TYPE_SHIP) {
 
 			int j;
@@ -708,6 +981,69 @@ void GameStateAsteroidsUpdate(void)
 		}
 	}
 
+	// Player bullets against every bot, the bullets gathered above but the ones out of the viewport
+	{
+		int bulletNum = 0, b, k;
+
+		for (k = 0; k < sgPlayerBulletNum; ++k)
+			if (sgpPlayerBullets[k]->mFlag & FLAG_ACTIVE)
+				sgpPlayerBullets[bulletNum++] = sgpPlayerBullets[k];
+
+		for (b = 0; b < sgBotTable.mBotNum && bulletNum > 0; ++b)
+		{
+			Vector2D botPosition;
+
+			Vector2DSet(&botPosition, sgBotTable.mX[b], sgBotTable.mY[b]);
+			for (k = 0; k < bulletNum;)
+			{
+				if (StaticPointToStaticRect(&sgpPlayerBullets[k]->mpComponent_Transform->mPosition, &botPosition, SHIP_SIZE, SHIP_SIZE) == 0)
+				{
+					++k;
+					continue;
+				}
+
+				// A bullet hits one bot
+				GameObjectInstanceDestroy(sgpPlayerBullets[k]);
+				sgpPlayerBullets[k] = sgpPlayerBullets[--bulletNum];
+				if (BotTableHit(&sgBotTable, b))
+				{
+					sgPlayerScore++;
+					AESysPrintf("PlayerScore = %d | BotScore = %d\n", sgPlayerScore, sgBotScore);
+				}
+			}
+		}
+	}
+
+	if (sgBotDataset.mpFile && sgBotTable.mBotNum > 0)
+	{
+		// Recording: the first bot is steered by hand and where it is sent is the desired output
+		float inputs[3], toMoveY = sgBotTable.mY[0];
+
+		if (AEInputCheckCurr('W'))
+			toMoveY += 3.5f;
+		if (AEInputCheckCurr('S'))
+			toMoveY -= 3.5f;
+		if (toMoveY < SHIP_SIZE)
+			toMoveY = SHIP_SIZE;
+		else if (toMoveY > 300.0f - SHIP_SIZE)
+			toMoveY = 300.0f - SHIP_SIZE;
+
+		inputs[0] = sgBotTable.mHP[0];
+		inputs[1] = (float)sgBotTable.mAmmo[0];
+		inputs[2] = fabsf(sgpShip->mpComponent_Transform->mPosition.y);
+		FuzzyDatasetAdd(&sgBotDataset, inputs, toMoveY);
+		sgBotTable.mFromY[0] = sgBotTable.mTargetY[0] = toMoveY;
+	}
+
+	// Every bot toward its decisions, then its instance where it is
+	BotTableMove(&sgBotTable, &sgBotScheduler);
+	{
+		int b;
+
+		for (b = 0; b < sgBotTable.mBotNum; ++b)
+			Vector2DSet(&sgpBots[b]->mpComponent_Transform->mPosition, sgBotTable.mX[b], sgBotTable.mY[b]);
+	}
+
 	// =====================================
 	// calculate the matrix for all objects
 	// =====================================
@@ -748,13 +1084,16 @@ void GameStateAsteroidsUpdate(void)
 
 	}
 
+#ifdef FUZZY_STATS
+	FuzzyStatsMerge(&sgBotFuzzyStats);
+#endif
 }
 
 // ---------------------------------------------------------------------------
 
 void GameStateAsteroidsDraw(void)
 {
-	int i;
+	int i, b;
 
 	
 		AEGfxSetRenderMode(AE_GFX_RM_COLOR);
@@ -796,13 +1135,6 @@ void GameStateAsteroidsDraw(void)
 			AEGfxMeshDraw(Lives, AE_GFX_MDM_TRIANGLES);
 		}
 
-		//Bot Lives
-		for (i = 0; i < sgBotLives; i++) {
-			AEGfxSetRenderMode(AE_GFX_RM_TEXTURE);
-			AEGfxSetPosition(BotX + (-22.0f + i * 15.0f), BotY + 40.0f);
-			AEGfxTextureSet(sgTextures[LIVES], 0.0f, 0.0f);
-			AEGfxMeshDraw(Lives, AE_GFX_MDM_TRIANGLES);
-		}
 
 		//Player Ammo
 		for (i = 0; i < PlayerCAmmo; i++) {
@@ -812,12 +1144,24 @@ void GameStateAsteroidsDraw(void)
 			AEGfxMeshDraw(Ammo, AE_GFX_MDM_TRIANGLES);
 		}
 
-		//BotAmmo
-		for (i = 0; i < BotCAmmo; i++) {
-			AEGfxSetRenderMode(AE_GFX_RM_TEXTURE);
-			AEGfxSetPosition(BotX - 40.0f, BotY + (25.0f - i * 12.0f));
-			AEGfxTextureSet(sgTextures[AMMO], 0.0f, 0.0f);
-			AEGfxMeshDraw(Ammo, AE_GFX_MDM_TRIANGLES);
+		//Bot Lives and Ammo, of the first bots
+		for (b = 0; b < sgBotTable.mBotNum && b < BOT_HUD_NUM_MAX; b++) {
+			float botX = sgBotTable.mX[b], botY = sgBotTable.mY[b];
+			int botLives = min((int)(sgBotTable.mHP[b] / 25) + 1, 4);
+
+			for (i = 0; i < botLives; i++) {
+				AEGfxSetRenderMode(AE_GFX_RM_TEXTURE);
+				AEGfxSetPosition(botX + (-22.0f + i * 15.0f), botY + 40.0f);
+				AEGfxTextureSet(sgTextures[LIVES], 0.0f, 0.0f);
+				AEGfxMeshDraw(Lives, AE_GFX_MDM_TRIANGLES);
+			}
+
+			for (i = 0; i < sgBotTable.mAmmo[b]; i++) {
+				AEGfxSetRenderMode(AE_GFX_RM_TEXTURE);
+				AEGfxSetPosition(botX - 40.0f, botY + (25.0f - i * 12.0f));
+				AEGfxTextureSet(sgTextures[AMMO], 0.0f, 0.0f);
+				AEGfxMeshDraw(Ammo, AE_GFX_MDM_TRIANGLES);
+			}
 		}
 }
 
@@ -867,7 +1211,76 @@ void GameStateAsteroidsUnload(void)
 	// No shapes at this point
 	sgShapeNum = 0;
 
-	
+	FuzzySurfaceFree(&sgBotFuzzySurface);
+	FuzzyOctreeFree(&sgBotFuzzyOctree);
+	FuzzyDatasetClose(&sgBotDataset);
+
+	AESysPrintf("Bot decisions of %d bots: %u in %u frames, %u deferred, longest frame %.1f us\n", sgBotTable.mBotNum,
+		sgBotScheduler.mDecisionNum, sgBotScheduler.mFrameNum, sgBotScheduler.mDeferredNum, sgBotScheduler.mTimeMax);
+	if (sgBotPlan.mPlanNum)
+	{
+		AESysPrintf("Bot plans: %u, %.1f rollouts each, %u dropped at the deadline, longest %.1f us\n", sgBotPlan.mPlanNum,
+			(double)sgBotPlan.mRolloutNum / sgBotPlan.mPlanNum, sgBotPlan.mDroppedNum, sgBotPlan.mTimeMax);
+	}
+	BotPlanFree(&sgBotPlan);
+	if (sgBotLod.mFrameNum)
+	{
+		static const char *lodNames[BOT_LOD_NUM] = { "near", "mid", "far" };
+
+		for (i = 0; i < BOT_LOD_NUM; ++i)
+		{
+			AESysPrintf("  %-4s: %.2f bots and %.3f decisions per frame\n", lodNames[i],
+				(double)sgBotLod.mBotNum[i] / sgBotLod.mFrameNum, (double)sgBotLod.mDecisionNum[i] / sgBotLod.mFrameNum);
+		}
+
+		// Fixed point takes precedence: these far bots did not use the lookup
+		// table, and no bot used its cache, the counters below leave them out
+		AESysPrintf("  %u decisions in fixed point, without the fuzzy caches and lookup tables\n", sgBotFixedDecisionNum);
+	}
+
+	{
+		unsigned int hitNum = 0, partialNum = 0, missNum = 0, total;
+		int b;
+
+		for (b = 0; b < sgBotTable.mBotNum; ++b)
+		{
+			hitNum += sgBotTable.mFuzzyCache[b].mHitNum;
+			partialNum += sgBotTable.mFuzzyCache[b].mPartialNum;
+			missNum += sgBotTable.mFuzzyCache[b].mMissNum;
+		}
+		total = hitNum + partialNum + missNum;
+
+		AESysPrintf("Fuzzy cache: %u hits, %u partial, %u misses (%.1f%% hits)\n",
+			hitNum, partialNum, missNum, total ? 100.0 * hitNum / total : 0.0);
+	}
+	if (sgBotFuzzyMemo.mShardNum)
+	{
+		unsigned int hitNum, missNum;
+
+		FuzzyMemoGetStats(&sgBotFuzzyMemo, &hitNum, &missNum);
+		AESysPrintf("Fuzzy memo: %u hits, %u misses (%.1f%% hits)\n",
+			hitNum, missNum, hitNum + missNum ? 100.0 * hitNum / (hitNum + missNum) : 0.0);
+	}
+	FuzzyMemoFree(&sgBotFuzzyMemo);
+
+#ifdef FUZZY_STATS
+	{
+		int deadNum;
+
+		FuzzyStatsMerge(&sgBotFuzzyStats);
+		deadNum = FuzzyStatsSave(&sgBotFuzzyStats, &sgBotRuleBase, BOT_STATS_FILE);
+		if (deadNum < 0)
+		{
+			AESysPrintf("Fuzzy rule statistics could not be written to %s\n", BOT_STATS_FILE);
+		}
+		else
+		{
+			AESysPrintf("Fuzzy rule statistics: %.0f evaluations, %d of %d rules never fired (%s)\n",
+				sgBotFuzzyStats.mTotal.mEvaluationNum, deadNum, sgBotRuleBase.mRuleNum, BOT_STATS_FILE);
+		}
+		FuzzyStatsAttach(0, 0);
+	}
+#endif
 }
 
 // ---------------------------------------------------------------------------
@@ -1083,138 +1496,336 @@ void RemoveComponent_Target(GameObjectInstance *pInst)
 
 float FindPlayer(Vector2D DirVec, Vector2D BotVec)
 {
-	float dotProduct, angle, distance;
-	Vector2D UpVec;
-
-	dotProduct = Vector2DDotProduct(&DirVec, &BotVec);
-	Vector2DSet(&UpVec, -DirVec.y, DirVec.x);
-
-
-	angle = acosf(dotProduct / (Vector2DLength(&DirVec)*Vector2DLength(&BotVec)));
-
-	if (Vector2DDotProduct(&UpVec, &BotVec) > 0)
+	// sin(angle) * |DirVec| is cross(BotVec, DirVec) / |BotVec|, without the trigonometry
+	if (sgBotFixed)
 	{
-		angle = -angle;//move left;
+		FuzzyFixed forward[2], offset[2];
+
+		forward[0] = FuzzyFixedFromFloat(BotVec.x);
+		forward[1] = FuzzyFixedFromFloat(BotVec.y);
+		offset[0] = FuzzyFixedFromFloat(DirVec.x);
+		offset[1] = FuzzyFixedFromFloat(DirVec.y);
+		return FuzzyFixedToFloat(FuzzyFixedLateral(forward, offset));
 	}
 
-	distance = sin(angle) * Vector2DLength(&DirVec);
-	//AESysPrintf("Angle %f toMove %f\n", angle * 180 / PI, distance);
-	return distance;
+	return BotPerceptionLateral(BotVec.x, BotVec.y, DirVec.x, DirVec.y);
 }
 
-float Triangle(float a, float b, float c, float x, int *side)
+// ---------------------------------------------------------------------------
+
+// Decision of the bot, run by sgBotScheduler: where it moves until the next one.
+// Far bots read the lookup table, a little off but cheaper than the inference
+void BotDecide(void *pContext, int agent)
 {
+	float lateral = sgBotPerception.mLateral[0][agent];
+	float dodge = 0.0f, chase = 1.0f;
 
+	if (sgBotFixed)
+	{
+		Vector2D DirectionVec, BotVec;
+
+		Vector2DSet(&DirectionVec, sgBotPerception.mOffsetX[0][agent], sgBotPerception.mOffsetY[0][agent]);
+		Vector2DSet(&BotVec, sgBotTable.mForwardX[agent], sgBotTable.mForwardY[agent]);
+		lateral = FindPlayer(DirectionVec, BotVec);
+	}
 
-	if (x >= a && x <= b) {
-		*side = 1;
-		if (a == b)
+	// Out of the path of the player's bullets first, then after the player, leaning to the side
+	// of the influence map with more opportunity than danger
+	if (sgBotDodgeModel.mInputNum)
+	{
+		BotThreat threat;
+		float x = sgBotTable.mX[agent], y = sgBotTable.mY[agent];
+		float opportunityRight, dangerRight, opportunityLeft, dangerLeft;
+
+		BotThreatQuery(&sgBotThreatGrid, x, y, &threat);
+		opportunityRight = sgBotSideInfluence[BOT_INFLUENCE_OPPORTUNITY][1][agent];
+		dangerRight = sgBotSideInfluence[BOT_INFLUENCE_DANGER][1][agent];
+		opportunityLeft = sgBotSideInfluence[BOT_INFLUENCE_OPPORTUNITY][0][agent];
+		dangerLeft = sgBotSideInfluence[BOT_INFLUENCE_DANGER][0][agent];
+
+		// In fixed point the samples are rounded first, as FindPlayer's vectors, and the side and the inference are exact
+		if (sgBotFixed)
 		{
-			return 1.0f;
+			FuzzyFixed inputs[3], outputs[FUZZY_OUTPUT_NUM_MAX];
+			FuzzyFixed one = FuzzyFixedFromFloat(1.0f);
+
+			inputs[0] = FuzzyFixedFromFloat(threat.mTime);
+			inputs[1] = FuzzyFixedFromFloat(threat.mEscapeX);
+			inputs[2] = (FuzzyFixedFromFloat(opportunityRight) - FuzzyFixedFromFloat(dangerRight))
+				- (FuzzyFixedFromFloat(opportunityLeft) - FuzzyFixedFromFloat(dangerLeft));
+			inputs[2] = max(-one, min(one, inputs[2]));
+			FuzzyFixedModelEvaluate(&sgBotDodgeFixed, inputs, outputs);
+			dodge = FuzzyFixedToFloat(outputs[0]);
+			chase = FuzzyFixedToFloat(outputs[1]);
 		}
 		else
 		{
-			
-			return ((x - a) / (b - a));
+			float inputs[3], outputs[FUZZY_OUTPUT_NUM_MAX];
+
+			inputs[0] = threat.mTime;
+			inputs[1] = threat.mEscapeX;
+			inputs[2] = max(-1.0f, min(1.0f, (opportunityRight - dangerRight) - (opportunityLeft - dangerLeft)));
+			FuzzyModelEvaluateOutputs(&sgBotDodgeModel, inputs, outputs);
+			dodge = outputs[0];
+			chase = outputs[1];
 		}
 	}
-	else if (x > b && x <= c)
+	sgBotTable.mTargetX[agent] = sgBotTable.mX[agent] + lateral * chase + dodge;
+
+	// Due, so the blend of the previous decisions has reached mTargetY
+	sgBotTable.mFromY[agent] = sgBotTable.mTargetY[agent];
+	BotLodCountDecision(&sgBotLod, agent);
+	FuzzyCacheSetMamdani(sgBotTable.mFuzzyCache + agent, sgBotMamdani[sgBotLod.mLevel[agent]]);
+	// Far bots prefer the lookup table, fixed point still applies to them
+	sgBotTable.mTargetY[agent] = getFuzzyOutputY(sgBotTable.mHP[agent], (float)sgBotTable.mAmmo[agent],
+		fabsf(sgpShip->mpComponent_Transform->mPosition.y),
+		sgBotLod.mLevel[agent] == BOT_LOD_FAR && sgBotFuzzySurface.mpSamples ? BOT_LOOKUP_SURFACE : sgBotLookup,
+		sgBotTable.mFuzzyCache + agent);
+
+	// The rollouts are a match of one bot against the player, in what is left of the frame's budget
+	if (sgBotPlanning && agent == 0)
+	{
+		BotSimWorld world;
+
+		BotPlanSnapshot(&world);
+		sgBotTable.mTargetY[agent] = BotPlanRun(&sgBotPlan, &world, sgBotTable.mTargetY[agent], BotSchedulerBudgetLeft(&sgBotScheduler));
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+// The first bot, the player and their first BOT_SIM_BULLET_NUM_MAX bullets, as a headless match (BotSim.h)
+void BotPlanSnapshot(BotSimWorld *pWorld)
+{
+	unsigned long i;
+
+	BotSimInit(pWorld, sgBotPlan.mPlanNum);
+	pWorld->mShipX = sgpShip->mpComponent_Transform->mPosition.x;
+	pWorld->mShipY = sgpShip->mpComponent_Transform->mPosition.y;
+	pWorld->mShipHP = PlayerCHP;
+	pWorld->mShipAmmo = PlayerCAmmo;
+	pWorld->mShipTimer = (float)timerP;
+	pWorld->mShipTargetY = pWorld->mShipY;
+	pWorld->mBotX = sgBotTable.mX[0];
+	pWorld->mBotY = sgBotTable.mY[0];
+	pWorld->mBotHP = sgBotTable.mHP[0];
+	pWorld->mBotAmmo = sgBotTable.mAmmo[0];
+	pWorld->mBotTimer = sgBotTable.mReloadTime[0];
+
+	// Player bullets first, they are the threat, then the bot's
+	for (i = 0; i < (unsigned long)sgPlayerBulletNum && pWorld->mBulletNum < BOT_SIM_BULLET_NUM_MAX; ++i)
+	{
+		BotSimBullet *pBullet = pWorld->mBullets + pWorld->mBulletNum++;
+
+		pBullet->mX = sgPlayerBulletX[i];
+		pBullet->mY = sgPlayerBulletY[i];
+		pBullet->mVelocityY = sgPlayerBulletVelocityY[i];
+	}
+	for (i = 0; i < GAME_OBJ_INST_NUM_MAX && pWorld->mBulletNum < BOT_SIM_BULLET_NUM_MAX; ++i)
+	{
+		GameObjectInstance* pInst = sgGameObjectInstanceList + i;
+		BotSimBullet *pBullet;
+
+		if ((pInst->mFlag & FLAG_ACTIVE) == 0 || pInst->mpComponent_Sprite->mpShape->mType != OBJECT_TYPE_BOT_BULLET)
+			continue;
+
+		pBullet = pWorld->mBullets + pWorld->mBulletNum++;
+		pBullet->mX = pInst->mpComponent_Transform->mPosition.x;
+		pBullet->mY = pInst->mpComponent_Transform->mPosition.y;
+		pBullet->mVelocityY = pInst->mpComponent_Physics->mVelocity.y;
+	}
+}
+
+// ---------------------------------------------------------------------------
+
+// Adds a bot at (x, y) to sgBotTable, sgpBots and sgBotScheduler, facing down
+// to the player. Returns its index, -1 if the bots or the instances are full
+int BotSpawn(float x, float y)
+{
+	GameObjectInstance *pInst;
+	int b;
+
+	if (sgBotTable.mBotNum >= BOT_TABLE_BOT_NUM_MAX)
+		return -1;
+	pInst = GameObjectInstanceCreate(OBJECT_TYPE_BOT);
+	if (pInst == 0)
+		return -1;
+
+	pInst->mpComponent_Transform->mScaleX = SHIP_SIZE;
+	pInst->mpComponent_Transform->mScaleY = SHIP_SIZE;
+	pInst->mpComponent_Transform->mAngle = -PI / 2;
+	Vector2DSet(&pInst->mpComponent_Transform->mPosition, x, y);
+
+	b = BotTableAdd(&sgBotTable, x, y, -PI / 2);
+	BotSchedulerAddAgent(&sgBotScheduler);
+
+	// HP and ammo only change in steps, any change is re-evaluated
+	{
+		float epsilon[3] = { 0.0f, 0.0f, BOT_PLAYER_EPSILON };
+
+		FuzzyCacheInit(sgBotTable.mFuzzyCache + b, &sgBotFuzzyModel, epsilon);
+	}
+	sgpBots[b] = pInst;
+
+	return b;
+}
+
+// ---------------------------------------------------------------------------
+
+// lookup (BOT_LOOKUP) is the source of the Sugeno form. BOT_LOOKUP_EXACT, and a bot deciding on the
+// Mamdani centroid (pCache->mMamdani), evaluate through the bot's pCache.
+// sgBotFixed takes precedence over both: the caches and lookup tables hold floats, which would make
+// the output depend on the machine again, so the fixed point model is evaluated every time
+// (sgBotFixedDecisionNum, reported with the level of detail counters)
+float getFuzzyOutputY(float x, float y, float z, int lookup, FuzzyCache *pCache)
+{
+	float inputs[3];
+	float outputs[FUZZY_OUTPUT_NUM_MAX];
+	float outy;
+
+	inputs[0] = x;
+	inputs[1] = y;
+	inputs[2] = z;
+
+	if (sgBotFixed)
 	{
-		*side = 2;
-		if (c == b)
+		FuzzyFixed fixedInputs[3], fixedOutputs[FUZZY_OUTPUT_NUM_MAX];
+
+		fixedInputs[0] = FuzzyFixedFromFloat(x);
+		fixedInputs[1] = FuzzyFixedFromFloat(y);
+		fixedInputs[2] = FuzzyFixedFromFloat(z);
+		FuzzyFixedModelEvaluate(&sgBotFuzzyFixed, fixedInputs, fixedOutputs);
+		++sgBotFixedDecisionNum;
+
+		if (fixedOutputs[0] < FuzzyFixedFromFloat(SHIP_SIZE))
 		{
-			return 1.0f;
+			fixedOutputs[0] = FuzzyFixedFromFloat(SHIP_SIZE);
 		}
-		else
+		else if (fixedOutputs[0] > FuzzyFixedFromFloat(300.0f - SHIP_SIZE))
 		{
-			return ((c - x) / (c - b));
+			fixedOutputs[0] = FuzzyFixedFromFloat(300.0f - SHIP_SIZE);
 		}
+		return FuzzyFixedToFloat(fixedOutputs[0]);
+	}
+
+	// The lookups below all sample the Sugeno form
+	if (pCache->mMamdani)
+	{
+		lookup = BOT_LOOKUP_EXACT;
+	}
+
+	if (lookup == BOT_LOOKUP_SURFACE)
+	{
+		return FuzzySurfaceEvaluate(&sgBotFuzzySurface, inputs);
+	}
+	else if (lookup == BOT_LOOKUP_OCTREE)
+	{
+		return FuzzyOctreeEvaluate(&sgBotFuzzyOctree, inputs);
+	}
+	else if (lookup == BOT_LOOKUP_MEMO)
+	{
+		return FuzzyMemoEvaluate(&sgBotFuzzyMemo, 0, inputs);
+	}
+	else if (lookup == BOT_LOOKUP_GENERATED)
+	{
+		FuzzyBotEvaluate(inputs, outputs);
+		outy = outputs[0];
 	}
 	else
 	{
-		return 0.0f;
+		FuzzyCacheEvaluate(pCache, inputs, outputs);
+		outy = outputs[0];
 	}
+	if (outy < SHIP_SIZE)
+	{
+		outy = SHIP_SIZE;
+	}
+	else if (outy > (300.0f - SHIP_SIZE))
+	{
+		outy = 300.0f - SHIP_SIZE;
+	}
+	return outy;
 }
 
-float getFuzzyOutputY(float x, float y, float z)
-{
-	float outy = BotY;
-	int i = 0, h, a, p, o;
-	int side;
-	float hh, aa, pp, numerator, denominator;
-	float hmid, amid, pmid, bmid;
+// ---------------------------------------------------------------------------
 
-	float HP[3][3] = {
+void BotRuleBaseDefault(FuzzyRuleBase *pRuleBase)
+{
+	static const FuzzyTriangle HP[3] = {
 		{0.0f,0.0f,50.0f},
 		{25.0f,50.0f,75.0f},
 		{50.0f,100.0f,100.0f}
 	};
-	float AM[2][3] = {
+	static const FuzzyTriangle AM[2] = {
 		{0.0f,0.0f,3.5f},
 		{1.5f,5.0f,5.0f}
 	};
-	float P[3][3] = {
+	static const FuzzyTriangle P[3] = {
 		{0.0f,0.0f,200.0f},
 		{100.0f,175.0f,250.0f},
 		{150.0f,300.0f,300.0f}
 	};
-	float BY[3][3] = {
+	static const FuzzyTriangle BY[3] = {
 		{0.0f,0.0f,150.0f},			//OF - 11,14,15,17
 		{100.0f,175.0f,250.0f},		//NO - 1,2,4,5,8,9,10,12,13,16
 		{150.0f,300.0f,300.0f}		//DF - 0,3,6,7
 	};
-	float firings[18], w[18];
-	float alpha, beta, gamma, constant;
-	
+	static const char InputNames[3][FUZZY_NAME_LEN] = { "BHP", "BAM", "PBH" };
+	static const char MfNames[3][3][FUZZY_NAME_LEN] = {
+		{ "LO", "MD", "HI" },
+		{ "LO", "HI" },
+		{ "OF", "NM", "DF" }
+	};
+	static const char OutputNames[3][FUZZY_NAME_LEN] = { "OF", "NM", "DF" };
+	int i = 0, h, a, p;
+
+	memset(pRuleBase, 0, sizeof(FuzzyRuleBase));
+
+	pRuleBase->mInputNum = 3;
+	pRuleBase->mMfNum[0] = 3;
+	pRuleBase->mMfNum[1] = 2;
+	pRuleBase->mMfNum[2] = 3;
+	memcpy(pRuleBase->mInputMf[0], HP, sizeof(HP));
+	memcpy(pRuleBase->mInputMf[1], AM, sizeof(AM));
+	memcpy(pRuleBase->mInputMf[2], P, sizeof(P));
+
+	pRuleBase->mOutputNum = 1;
+	pRuleBase->mOutputMfNum[0] = 3;
+	memcpy(pRuleBase->mOutputMf[0], BY, sizeof(BY));
+
+	// Names from the design document (AutoBot.pdf)
+	memcpy(pRuleBase->mInputName, InputNames, sizeof(InputNames));
+	for (h = 0; h < 3; ++h)
+		memcpy(pRuleBase->mInputMfName[h], MfNames[h], sizeof(MfNames[h]));
+	memcpy(pRuleBase->mOutputMfName[0], OutputNames, sizeof(OutputNames));
+	memcpy(pRuleBase->mOutputName[0], "BBH", 4);
+
+	// 3x2x3 grid of rules, rule i = (HP h, AM a, P p)
 	for (h = 0; h < 3; ++h)
 	{
-		hh = Triangle(HP[h][0], HP[h][1], HP[h][2], x , &side);
 		for (a = 0; a < 2; ++a)
 		{
-			aa = Triangle(AM[a][0], AM[a][1], AM[a][2], y, &side);
 			for (p = 0; p < 3; ++p)
 			{
-				pp = Triangle(P[p][0], P[p][1], P[p][2], z, &side);
+				pRuleBase->mRuleMf[i][0] = h;
+				pRuleBase->mRuleMf[i][1] = a;
+				pRuleBase->mRuleMf[i][2] = p;
+
 				if (i == 0 || i == 3 || i == 6 || i == 7)
 				{
-					o = 2;
+					pRuleBase->mRuleOutput[i][0] = 2;
 				}
 				else if (i == 11 || i == 14 || i == 15 || i == 17)
 				{
-					o = 0;
+					pRuleBase->mRuleOutput[i][0] = 0;
 				}
 				else
 				{
-					o = 1;
+					pRuleBase->mRuleOutput[i][0] = 1;
 				}
-				alpha = (BY[o][2] - BY[o][0]) / (HP[h][2] - HP[h][0]);
-				beta = (BY[o][2] - BY[o][0]) / (AM[a][2] - AM[a][0]);
-				gamma = (BY[o][2] - BY[o][0]) / (P[p][2] - P[p][0]);
-				constant = BY[o][1] - (alpha*HP[h][1]) - (beta*AM[a][1]) - (gamma*P[p][1]);
-				firings[i] = min(hh, min(aa, pp));
-				w[i] = alpha * x + beta * y + gamma * z + constant;
 				++i;
 			}
 		}
 	}
-	
-
-	numerator = denominator = 0.0f;
-
-	for (i = 0; i < 18; ++i)
-	{
-		numerator += firings[i] * w[i];
-		denominator += firings[i];
-	}
-	
-	outy = numerator / denominator;
-	if (outy < SHIP_SIZE)
-	{
-		outy = SHIP_SIZE;
-	}
-	else if (outy > (300.0f - SHIP_SIZE))
-	{
-		outy = 300.0f - SHIP_SIZE;
-	}
-	return outy;
-}
\ No newline at end of file
+	pRuleBase->mRuleNum = i;
+}
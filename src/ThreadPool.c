@@ -0,0 +1,173 @@
+/* Start Header -------------------------------------------------------
+
+Copyright (C) 2018 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the prior
+written consent of DigiPen Institute
+of Technology is prohibited.
+File Name:		ThreadPool.c
+Purpose:		Worker threads running indexed tasks in parallel
+Language:		C
+Platform:		Visual Studio 2017 | Visual C++ 14.1 | Windows 10 Home
+Project:		MAT562_FuzzyLogics_Project
+Author:			agent
+Creation date:	10/18/2026
+
+- End Header --------------------------------------------------------*/
+
+#include "ThreadPool.h"
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// ---------------------------------------------------------------------------
+
+// Runs tasks of the current run until there are none left
+static void ThreadPoolWork(ThreadPool *pPool, int thread)
+{
+	long index;
+
+#ifdef _WIN32
+	while ((index = InterlockedIncrement(&pPool->mNext) - 1) < pPool->mCount)
+		pPool->mpTask(pPool->mpContext, (int)index, thread);
+#else
+	while ((index = pPool->mNext++) < pPool->mCount)
+		pPool->mpTask(pPool->mpContext, (int)index, thread);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+
+#ifdef _WIN32
+// A worker takes one start count per run. A fast worker can take 2 counts of
+// the same run, the second one finds no task left: every count is still
+// returned once, so the run ends when all of them are
+static DWORD WINAPI ThreadPoolWorkerProc(LPVOID pParam)
+{
+	ThreadPoolWorker *pWorker = (ThreadPoolWorker *)pParam;
+	ThreadPool *pPool = pWorker->mpPool;
+
+	for (;;)
+	{
+		WaitForSingleObject(pPool->mpStart, INFINITE);
+		if (pPool->mQuit)
+		{
+			break;
+		}
+
+		ThreadPoolWork(pPool, pWorker->mIndex);
+
+		if (InterlockedDecrement(&pPool->mBusy) == 0)
+		{
+			SetEvent(pPool->mpDone);
+		}
+	}
+
+	return 0;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+
+int ThreadPoolInit(ThreadPool *pPool, int threadNum)
+{
+	int result = 1;
+
+	memset(pPool, 0, sizeof(ThreadPool));
+	pPool->mThreadNum = 1;
+
+#ifdef _WIN32
+	if (threadNum <= 0)
+	{
+		SYSTEM_INFO info;
+
+		GetSystemInfo(&info);
+		threadNum = (int)info.dwNumberOfProcessors;
+	}
+	threadNum = threadNum > THREAD_POOL_THREAD_NUM_MAX ? THREAD_POOL_THREAD_NUM_MAX : threadNum;
+
+	pPool->mpStart = CreateSemaphoreA(0, 0, THREAD_POOL_THREAD_NUM_MAX, 0);
+	pPool->mpDone = CreateEventA(0, FALSE, FALSE, 0);
+	if (pPool->mpStart == 0 || pPool->mpDone == 0)
+	{
+		result = 0;
+	}
+
+	while (result && pPool->mThreadNum < threadNum)
+	{
+		ThreadPoolWorker *pWorker = pPool->mWorkers + pPool->mThreadNum;
+
+		pWorker->mpPool = pPool;
+		pWorker->mIndex = pPool->mThreadNum;
+		pWorker->mpThread = CreateThread(0, 0, ThreadPoolWorkerProc, pWorker, 0, 0);
+		if (pWorker->mpThread == 0)
+		{
+			result = 0;
+		}
+		else
+		{
+			++pPool->mThreadNum;
+		}
+	}
+#else
+	result = threadNum <= 1;
+#endif
+
+	return result;
+}
+
+// ---------------------------------------------------------------------------
+
+void ThreadPoolRun(ThreadPool *pPool, ThreadPoolTask task, void *pContext, int count)
+{
+	pPool->mpTask = task;
+	pPool->mpContext = pContext;
+	pPool->mCount = count;
+	pPool->mNext = 0;
+
+	if (pPool->mThreadNum == 1 || count <= 1)
+	{
+		ThreadPoolWork(pPool, 0);
+		return;
+	}
+
+#ifdef _WIN32
+	// The releasing call orders the writes above before the workers read them
+	pPool->mBusy = pPool->mThreadNum - 1;
+	ReleaseSemaphore(pPool->mpStart, pPool->mThreadNum - 1, 0);
+	ThreadPoolWork(pPool, 0);
+	WaitForSingleObject(pPool->mpDone, INFINITE);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+
+void ThreadPoolFree(ThreadPool *pPool)
+{
+#ifdef _WIN32
+	int i;
+
+	if (pPool->mThreadNum > 1)
+	{
+		pPool->mQuit = 1;
+		ReleaseSemaphore(pPool->mpStart, pPool->mThreadNum - 1, 0);
+		for (i = 1; i < pPool->mThreadNum; ++i)
+		{
+			WaitForSingleObject(pPool->mWorkers[i].mpThread, INFINITE);
+			CloseHandle(pPool->mWorkers[i].mpThread);
+		}
+	}
+	if (pPool->mpStart)
+	{
+		CloseHandle(pPool->mpStart);
+	}
+	if (pPool->mpDone)
+	{
+		CloseHandle(pPool->mpDone);
+	}
+#endif
+
+	memset(pPool, 0, sizeof(ThreadPool));
+	pPool->mThreadNum = 1;
+}
@@ -12,11 +12,17 @@
 // includes
 
 #include "main.h"
+#include "FuzzyIO.h"
+#include "BotTune.h"
+#include "FuzzyTrain.h"
+#include "FuzzyCompact.h"
+#include "FuzzyCheck.h"
 
 
 // ---------------------------------------------------------------------------
 // Static function protoypes
 
+static void MainOpenConsole(void);
 
 // ---------------------------------------------------------------------------
 // main
@@ -25,6 +31,123 @@ int WINAPI WinMain(HINSTANCE instanceH, HINSTANCE prevInstanceH, LPSTR command_l
 {
 	// Initialize the system 
 	AESysInitInfo sysInitInfo;
+	char textFile[MAX_PATH], binaryFile[MAX_PATH], dataFile[MAX_PATH];
+
+	// "-compile <text rule base> <binary rule base>": compile a bot personality and exit
+	if (sscanf_s(command_line, "-compile %259s %259s", textFile, (unsigned)sizeof(textFile), binaryFile, (unsigned)sizeof(binaryFile)) == 2)
+	{
+		FuzzyRuleBase ruleBase;
+
+		if (!FuzzyRuleBaseLoad(&ruleBase, textFile) || !FuzzyRuleBaseSaveBinary(&ruleBase, binaryFile))
+		{
+			MessageBoxA(NULL, FuzzyIOGetError(), "Rule base compilation failed", MB_OK | MB_ICONERROR);
+			return 1;
+		}
+		return 0;
+	}
+
+	// "-tune <text rule base> <tuned text rule base> [generations [threads]]":
+	// tune a bot personality against the scripted player and exit
+	if (sscanf_s(command_line, "-tune %259s %259s", textFile, (unsigned)sizeof(textFile), binaryFile, (unsigned)sizeof(binaryFile)) == 2)
+	{
+		FuzzyRuleBase ruleBase, tuned;
+		BotTuneSettings settings;
+
+		BotTuneDefaultSettings(&settings);
+		sscanf_s(command_line, "-tune %*s %*s %d %d", &settings.mGenerationNum, &settings.mThreadNum);
+
+		if (!FuzzyRuleBaseLoad(&ruleBase, textFile))
+		{
+			MessageBoxA(NULL, FuzzyIOGetError(), "Rule base tuning failed", MB_OK | MB_ICONERROR);
+			return 1;
+		}
+
+		MainOpenConsole();
+		BotTune(&tuned, &ruleBase, &settings, stdout);
+
+		if (!FuzzyRuleBaseSaveText(&tuned, binaryFile))
+		{
+			MessageBoxA(NULL, FuzzyIOGetError(), "Rule base tuning failed", MB_OK | MB_ICONERROR);
+			return 1;
+		}
+		return 0;
+	}
+
+	// "-train <text rule base> <dataset> <consequents>": fit the bot's
+	// consequents to recorded play (FuzzyTrain.h) and exit
+	if (sscanf_s(command_line, "-train %259s %259s %259s", textFile, (unsigned)sizeof(textFile),
+		dataFile, (unsigned)sizeof(dataFile), binaryFile, (unsigned)sizeof(binaryFile)) == 3)
+	{
+		FuzzyRuleBase ruleBase;
+		FuzzyModel model;
+		FuzzyTrainStats stats;
+		unsigned int hash;
+
+		if (!FuzzyRuleBaseLoad(&ruleBase, textFile))
+		{
+			MessageBoxA(NULL, FuzzyIOGetError(), "Rule base training failed", MB_OK | MB_ICONERROR);
+			return 1;
+		}
+		FuzzyModelCompile(&model, &ruleBase);
+		hash = FuzzyModelHash(&model);
+
+		if (!FuzzyModelTrain(&model, 0, dataFile, FUZZY_TRAIN_RIDGE, &stats) || !FuzzyConsequentsSave(&model, hash, binaryFile))
+		{
+			MessageBoxA(NULL, FuzzyTrainGetError(), "Rule base training failed", MB_OK | MB_ICONERROR);
+			return 1;
+		}
+
+		MainOpenConsole();
+		printf("%u samples (%u outside of every rule), RMS error %g -> %g\n",
+			stats.mSampleNum, stats.mSkipNum, stats.mErrorBefore, stats.mErrorAfter);
+		return 0;
+	}
+
+	// "-compact <text rule base> <reduced text rule base> [tolerance]": report
+	// the coverage problems of a bot personality, reduce it and exit
+	if (sscanf_s(command_line, "-compact %259s %259s", textFile, (unsigned)sizeof(textFile), binaryFile, (unsigned)sizeof(binaryFile)) == 2)
+	{
+		// Domain of the bot's inputs and range of its height, as in GameStateAsteroidsLoad
+		FuzzyCompactDomain domain = { { 0.0f, 0.0f, 0.0f }, { 100.0f, 5.0f, 300.0f }, 60.0f, 240.0f, 1u << 1 };
+		FuzzyRuleBase ruleBase, reduced;
+		float tolerance = 10.0f;
+
+		sscanf_s(command_line, "-compact %*s %*s %f", &tolerance);
+
+		if (!FuzzyRuleBaseLoad(&ruleBase, textFile))
+		{
+			MessageBoxA(NULL, FuzzyIOGetError(), "Rule base compaction failed", MB_OK | MB_ICONERROR);
+			return 1;
+		}
+
+		MainOpenConsole();
+		printf("%d problems found\n", FuzzyRuleBaseAnalyze(&ruleBase, &domain, stdout));
+		FuzzyRuleBaseCompact(&reduced, &ruleBase, &domain, tolerance, stdout);
+
+		if (!FuzzyRuleBaseSaveText(&reduced, binaryFile))
+		{
+			MessageBoxA(NULL, FuzzyIOGetError(), "Rule base compaction failed", MB_OK | MB_ICONERROR);
+			return 1;
+		}
+		return 0;
+	}
+
+	// "-test <text rule base>": check every fuzzy evaluator and bot query
+	// against its reference (FuzzyCheck.h), exit with 1 if any check failed
+	if (sscanf_s(command_line, "-test %259s", textFile, (unsigned)sizeof(textFile)) == 1)
+	{
+		FuzzyRuleBase ruleBase;
+
+		if (!FuzzyRuleBaseLoad(&ruleBase, textFile))
+		{
+			MessageBoxA(NULL, FuzzyIOGetError(), "Rule base check failed", MB_OK | MB_ICONERROR);
+			return 1;
+		}
+
+		// Range of the bot's height, as in GameStateAsteroidsLoad
+		MainOpenConsole();
+		return FuzzyCheckRun(&ruleBase, 60.0f, 240.0f, stdout) ? 1 : 0;
+	}
 
 	sysInitInfo.mAppInstance		= instanceH;
 	sysInitInfo.mShow				= show;
@@ -54,4 +177,19 @@ int WINAPI WinMain(HINSTANCE instanceH, HINSTANCE prevInstanceH, LPSTR command_l
 	return 1;
 }
 
-// ---------------------------------------------------------------------------
\ No newline at end of file
+// ---------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------
+// Static functions
+
+// Output of the command line tools goes to the console they were started from, or to a new one
+static void MainOpenConsole(void)
+{
+	FILE *pConsole;
+
+	if (!AttachConsole(ATTACH_PARENT_PROCESS))
+		AllocConsole();
+	freopen_s(&pConsole, "CONOUT$", "w", stdout);
+}
+
+// ---------------------------------------------------------------------------